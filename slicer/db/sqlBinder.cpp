@@ -1,9 +1,16 @@
 #include "sqlBinder.h"
 #include <command.h>
+#include <type_traits>
 
 namespace Slicer {
 	SqlBinder::SqlBinder(DB::Command & c, unsigned int i) : command(c), idx(i) { }
 
+	const void *
+	SqlBinder::exchange(ExchangeType t) const
+	{
+		return exchangeFor<Slicer::TValueTarget, boost::posix_time::ptime, boost::posix_time::time_duration>(this, t);
+	}
+
 	void
 	SqlBinder::get(const boost::posix_time::ptime & b) const
 	{
@@ -63,4 +70,49 @@ namespace Slicer {
 	{
 		command.bindParamS(idx, b);
 	}
+
+	SqlValueCollector::SqlValueCollector(SqlValues & v) : values(v) { }
+
+	const void *
+	SqlValueCollector::exchange(ExchangeType t) const
+	{
+		return exchangeFor<Slicer::TValueTarget, boost::posix_time::ptime, boost::posix_time::time_duration>(this, t);
+	}
+
+#define CollectType(T) \
+	void SqlValueCollector::get(const T & b) const \
+	{ \
+		values.emplace_back(b); \
+	}
+
+	CollectType(boost::posix_time::ptime)
+	CollectType(boost::posix_time::time_duration)
+	CollectType(bool)
+	CollectType(Ice::Byte)
+	CollectType(Ice::Short)
+	CollectType(Ice::Int)
+	CollectType(Ice::Long)
+	CollectType(Ice::Float)
+	CollectType(Ice::Double)
+	CollectType(std::string)
+#undef CollectType
+
+	void
+	bindValues(DB::Command & c, const SqlValues & values)
+	{
+		unsigned int idx = 0;
+		for (const auto & value : values) {
+			std::visit(
+					[&c, idx](const auto & v) {
+						if constexpr (std::is_same_v<std::decay_t<decltype(v)>, std::nullptr_t>) {
+							c.bindNull(idx);
+						}
+						else {
+							SqlBinder(c, idx).get(v);
+						}
+					},
+					value);
+			idx++;
+		}
+	}
 }
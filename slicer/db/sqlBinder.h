@@ -3,7 +3,10 @@
 #include <Ice/Config.h>
 #include <boost/date_time/posix_time/posix_time.hpp>
 #include <slicer/modelParts.h>
+#include <cstddef>
 #include <string>
+#include <variant>
+#include <vector>
 
 namespace DB {
 	class Command;
@@ -27,9 +30,40 @@ namespace Slicer {
 		void get(const Ice::Float & b) const override;
 		void get(const Ice::Double & b) const override;
 		void get(const std::string & b) const override;
+		[[nodiscard]] const void * exchange(ExchangeType) const override;
 
 	private:
 		DB::Command & command;
 		const unsigned int idx;
 	};
+
+	using SqlValue = std::variant<std::nullptr_t, bool, Ice::Byte, Ice::Short, Ice::Int, Ice::Long, Ice::Float,
+			Ice::Double, std::string, boost::posix_time::ptime, boost::posix_time::time_duration>;
+	using SqlValues = std::vector<SqlValue>;
+
+	// Captures values for binding later, e.g. whilst accumulating the rows of a multi-row statement.
+	class SqlValueCollector :
+		public Slicer::ValueTarget,
+		public Slicer::TValueTarget<boost::posix_time::time_duration>,
+		public Slicer::TValueTarget<boost::posix_time::ptime> {
+	public:
+		explicit SqlValueCollector(SqlValues & v);
+
+		void get(const boost::posix_time::ptime & b) const override;
+		void get(const boost::posix_time::time_duration & b) const override;
+		void get(const bool & b) const override;
+		void get(const Ice::Byte & b) const override;
+		void get(const Ice::Short & b) const override;
+		void get(const Ice::Int & b) const override;
+		void get(const Ice::Long & b) const override;
+		void get(const Ice::Float & b) const override;
+		void get(const Ice::Double & b) const override;
+		void get(const std::string & b) const override;
+		[[nodiscard]] const void * exchange(ExchangeType) const override;
+
+	private:
+		SqlValues & values;
+	};
+
+	void bindValues(DB::Command & c, const SqlValues & values);
 }
@@ -2,42 +2,36 @@
 #include <compileTimeFormatter.h>
 #include <slicer/modelParts.h>
 #include <sqlExceptions.h>
-#include <string_view>
 
 namespace Slicer {
-	constexpr std::string_view md_pkey {"db:pkey"};
-	constexpr std::string_view md_auto {"db:auto"};
-	constexpr std::string_view md_ignore {"db:ignore"};
-	constexpr std::string_view md_global_ignore {"ignore"};
-
 	bool
 	isPKey(const HookCommon * h) noexcept
 	{
-		return h->GetMetadata().flagSet(md_pkey) && isBind(h);
+		return h->flagSet(MetaFlag::DbPKey) && isBind(h);
 	}
 
 	bool
 	isAuto(const HookCommon * h) noexcept
 	{
-		return h->GetMetadata().flagSet(md_auto) && isBind(h);
+		return h->flagSet(MetaFlag::DbAuto) && isBind(h);
 	}
 
 	bool
 	isNotAuto(const HookCommon * h) noexcept
 	{
-		return h->GetMetadata().flagNotSet(md_auto) && isBind(h);
+		return !h->flagSet(MetaFlag::DbAuto) && isBind(h);
 	}
 
 	bool
 	isBind(const HookCommon * h) noexcept
 	{
-		return h->GetMetadata().flagNotSet(md_global_ignore) && h->GetMetadata().flagNotSet(md_ignore);
+		return !h->flagSet(MetaFlag::Ignore) && !h->flagSet(MetaFlag::DbIgnore);
 	}
 
 	bool
 	isValue(const HookCommon * h) noexcept
 	{
-		return h->GetMetadata().flagNotSet(md_auto) && h->GetMetadata().flagNotSet(md_pkey) && isBind(h);
+		return !h->flagSet(MetaFlag::DbAuto) && !h->flagSet(MetaFlag::DbPKey) && isBind(h);
 	}
 
 	void
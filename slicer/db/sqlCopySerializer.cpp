@@ -0,0 +1,233 @@
+#include "sqlCopySerializer.h"
+#include "sqlCommon.h"
+#include <Ice/Config.h>
+#include <array>
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include <charconv>
+#include <common.h>
+#include <connection.h>
+#include <slicer/modelParts.h>
+#include <utility>
+
+namespace Slicer {
+	constexpr std::size_t COPY_BUFFER_SIZE {1U << 16U};
+
+	// Appends values in PostgreSQL's COPY text format.
+	class SqlCopyWriter :
+		public Slicer::ValueTarget,
+		public Slicer::TValueTarget<boost::posix_time::time_duration>,
+		public Slicer::TValueTarget<boost::posix_time::ptime> {
+	public:
+		explicit SqlCopyWriter(std::string & o) : out(o) { }
+
+		[[nodiscard]] const void *
+		exchange(ExchangeType t) const override
+		{
+			return exchangeFor<Slicer::TValueTarget, boost::posix_time::ptime, boost::posix_time::time_duration>(this, t);
+		}
+
+		void
+		get(const boost::posix_time::ptime & b) const override
+		{
+			out += boost::posix_time::to_iso_extended_string(b);
+		}
+
+		void
+		get(const boost::posix_time::time_duration & b) const override
+		{
+			out += boost::posix_time::to_simple_string(b);
+		}
+
+		void
+		get(const bool & b) const override
+		{
+			out += b ? 't' : 'f';
+		}
+
+		void
+		get(const Ice::Byte & b) const override
+		{
+			number(b);
+		}
+
+		void
+		get(const Ice::Short & b) const override
+		{
+			number(b);
+		}
+
+		void
+		get(const Ice::Int & b) const override
+		{
+			number(b);
+		}
+
+		void
+		get(const Ice::Long & b) const override
+		{
+			number(b);
+		}
+
+		void
+		get(const Ice::Float & b) const override
+		{
+			number(b);
+		}
+
+		void
+		get(const Ice::Double & b) const override
+		{
+			number(b);
+		}
+
+		void
+		get(const std::string & b) const override
+		{
+			for (const auto c : b) {
+				switch (c) {
+					case '\\':
+						out += "\\\\";
+						break;
+					case '\t':
+						out += "\\t";
+						break;
+					case '\n':
+						out += "\\n";
+						break;
+					case '\r':
+						out += "\\r";
+						break;
+					default:
+						out += c;
+				}
+			}
+		}
+
+	private:
+		template<typename T>
+		void
+		number(const T v) const
+		{
+			std::array<char, 32> buf {};
+			const auto result = std::to_chars(buf.begin(), buf.end(), v);
+			out.append(buf.begin(), result.ptr);
+		}
+
+		std::string & out;
+	};
+
+	SqlCopySerializer::SqlCopySerializer(DB::Connection * const c, std::string t) :
+		connection(c), tableName(std::move(t))
+	{
+	}
+
+	void
+	SqlCopySerializer::Serialize(ModelPartForRootParam mp)
+	{
+		switch (mp->GetType()) {
+			case Slicer::ModelPartType::Sequence:
+				mp->OnEachChild([this](auto &&, auto && PH2, auto &&) {
+					SerializeSequence(PH2);
+				});
+				return;
+			case Slicer::ModelPartType::Complex:
+				mp->OnEachChild([this](auto &&, auto && PH2, auto &&) {
+					SerializeObject(PH2);
+				});
+				return;
+			default:
+				throw UnsupportedModelType();
+		}
+	}
+
+	void
+	SqlCopySerializer::SerializeObject(ModelPartParam mp)
+	{
+		copyRows(mp, [this, mp] {
+			writeRow(mp);
+		});
+	}
+
+	void
+	SqlCopySerializer::SerializeSequence(ModelPartParam mp)
+	{
+		mp->OnContained([this, mp](auto && cmp) {
+			copyRows(cmp, [this, mp] {
+				mp->OnEachChild([this](auto &&, auto && chmp, auto &&) {
+					writeRow(chmp);
+					flush(COPY_BUFFER_SIZE);
+				});
+			});
+		});
+	}
+
+	void
+	SqlCopySerializer::copyRows(ModelPartParam cmp, const std::function<void()> & rows)
+	{
+		buffer.clear();
+		buffer.reserve(COPY_BUFFER_SIZE);
+		connection->beginBulkUpload(columnList(cmp).c_str(), "");
+		try {
+			rows();
+			flush(0);
+		}
+		catch (...) {
+			connection->endBulkUpload("Slicer serialization failed");
+			throw;
+		}
+		connection->endBulkUpload(nullptr);
+	}
+
+	void
+	SqlCopySerializer::writeRow(ModelPartParam mp)
+	{
+		bool first = true;
+		mp->OnEachChild([this, &first](auto &&, auto && fmp, auto && h) {
+			if (isCopyField(h)) {
+				if (!std::exchange(first, false)) {
+					buffer += '\t';
+				}
+				if (!fmp->GetValue(SqlCopyWriter(buffer))) {
+					buffer += "\\N";
+				}
+			}
+		});
+		buffer += '\n';
+	}
+
+	void
+	SqlCopySerializer::flush(std::size_t threshold)
+	{
+		if (!buffer.empty() && buffer.size() >= threshold) {
+			connection->bulkUploadData(buffer.data(), buffer.size());
+			buffer.clear();
+		}
+	}
+
+	std::string
+	SqlCopySerializer::columnList(ModelPartParam mp) const
+	{
+		std::string columns {tableName};
+		char sep = '(';
+		mp->OnEachChild([this, &columns, &sep](auto && name, auto &&, auto && h) {
+			if (isCopyField(h)) {
+				columns += std::exchange(sep, ',');
+				columns += name;
+			}
+		});
+		columns += ')';
+		return columns;
+	}
+
+	bool
+	SqlCopySerializer::isCopyField(const HookCommon * h) const
+	{
+		return isBind(h);
+	}
+
+	bool
+	SqlAutoIdCopySerializer::isCopyField(const HookCommon * h) const
+	{
+		return isNotAuto(h);
+	}
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <slicer/modelParts.h>
+#include <slicer/serializer.h>
+#include <string>
+#include <visibility.h>
+
+namespace DB {
+	class Connection;
+}
+
+namespace Slicer {
+	// Loads rows through the connection's bulk upload interface (COPY ... FROM STDIN) in text format.
+	class DLL_PUBLIC SqlCopySerializer : public Slicer::Serializer {
+	public:
+		SqlCopySerializer(DB::Connection * const, std::string tableName);
+
+		void Serialize(ModelPartForRootParam) override;
+
+	protected:
+		void SerializeObject(ModelPartParam);
+		void SerializeSequence(ModelPartParam);
+		void copyRows(ModelPartParam, const std::function<void()> & rows);
+		void writeRow(ModelPartParam);
+		void flush(std::size_t threshold);
+		[[nodiscard]] std::string columnList(ModelPartParam) const;
+		[[nodiscard]] virtual bool isCopyField(const HookCommon * h) const;
+
+		DB::Connection * const connection;
+		const std::string tableName;
+		std::string buffer;
+	};
+
+	class DLL_PUBLIC SqlAutoIdCopySerializer : public SqlCopySerializer {
+	public:
+		using SqlCopySerializer::SqlCopySerializer;
+
+	protected:
+		[[nodiscard]] bool isCopyField(const HookCommon * h) const override;
+	};
+}
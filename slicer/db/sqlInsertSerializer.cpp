@@ -4,6 +4,7 @@
 #include "sqlCommon.h"
 #include "sqlExceptions.h"
 #include <Ice/Config.h>
+#include <algorithm>
 #include <boost/numeric/conversion/cast.hpp>
 #include <command_fwd.h>
 #include <compileTimeFormatter.h>
@@ -14,8 +15,13 @@
 #include <utility>
 
 namespace Slicer {
-	SqlInsertSerializer::SqlInsertSerializer(DB::Connection * const c, std::string t) :
-		connection(c), tableName(std::move(t))
+	SqlInsertSerializer::SqlInsertSerializer(DB::Connection * const c, std::string t, SqlInsertBatching b) :
+		connection(c), tableName(std::move(t)), batching(b)
+	{
+	}
+
+	SqlFetchIdInsertSerializer::SqlFetchIdInsertSerializer(DB::Connection * const c, std::string t) :
+		SqlAutoIdInsertSerializer(c, std::move(t))
 	{
 	}
 
@@ -49,12 +55,52 @@ namespace Slicer {
 	SqlInsertSerializer::SerializeSequence(ModelPartParam mp) const
 	{
 		mp->OnContained([this, mp](auto && cmp) {
+			if (batching.maxRows > 1) {
+				return SerializeSequenceBatched(mp, cmp);
+			}
 			mp->OnEachChild([ins = createInsert(cmp), this](auto &&, auto && chmp, auto &&) {
 				bindObjectAndExecute(chmp, ins.get());
 			});
 		});
 	}
 
+	void
+	SqlInsertSerializer::SerializeSequenceBatched(ModelPartParam mp, ModelPartParam cmp) const
+	{
+		unsigned int fields = 0;
+		const auto prefix = createInsertPrefix(cmp, fields);
+		const auto rows = std::clamp(batching.maxParams / std::max(fields, 1U), 1U, batching.maxRows);
+
+		SqlValues values;
+		values.reserve(rows * fields);
+		unsigned int pending = 0;
+		DB::ModifyCommandPtr full;
+		const auto execute = [&values, &pending](DB::ModifyCommand * ins) {
+			bindValues(*ins, values);
+			ins->execute();
+			values.clear();
+			pending = 0;
+		};
+		mp->OnEachChild([&, this](auto &&, auto && chmp, auto &&) {
+			chmp->OnEachChild([&values, this](auto &&, auto && fmp, auto && h) {
+				if (isInsertField(h)) {
+					if (!fmp->GetValue(SqlValueCollector(values))) {
+						values.emplace_back(nullptr);
+					}
+				}
+			});
+			if (++pending == rows) {
+				if (!full) {
+					full = createInsert(prefix, fields, rows);
+				}
+				execute(full.get());
+			}
+		});
+		if (pending) {
+			execute(createInsert(prefix, fields, pending).get());
+		}
+	}
+
 	void
 	SqlInsertSerializer::bindObjectAndExecute(ModelPartParam cmp, DB::ModifyCommand * ins) const
 	{
@@ -115,7 +161,7 @@ namespace Slicer {
 	SqlInsertSerializer::bindObjectAndExecuteField(
 			unsigned int & paramNo, DB::ModifyCommand * ins, ModelPartParam cmp, const HookCommon * h) const
 	{
-		if (isBind(h)) {
+		if (isInsertField(h)) {
 			if (!cmp->GetValue(SqlBinder(*ins, paramNo))) {
 				ins->bindNull(paramNo);
 			}
@@ -123,50 +169,59 @@ namespace Slicer {
 		}
 	}
 
-	void
-	SqlAutoIdInsertSerializer::bindObjectAndExecuteField(
-			unsigned int & paramNo, DB::ModifyCommand * ins, ModelPartParam cmp, const HookCommon * h) const
+	bool
+	SqlInsertSerializer::isInsertField(const HookCommon * h) const
 	{
-		if (isNotAuto(h)) {
-			SqlInsertSerializer::bindObjectAndExecuteField(paramNo, ins, cmp, h);
-		}
+		return isBind(h);
+	}
+
+	bool
+	SqlAutoIdInsertSerializer::isInsertField(const HookCommon * h) const
+	{
+		return isNotAuto(h);
 	}
 
 	DB::ModifyCommandPtr
 	SqlInsertSerializer::createInsert(ModelPartParam mp) const
+	{
+		unsigned int fieldNo = 0;
+		const auto prefix = createInsertPrefix(mp, fieldNo);
+		return createInsert(prefix, fieldNo, 1);
+	}
+
+	std::string
+	SqlInsertSerializer::createInsertPrefix(ModelPartParam mp, unsigned int & fieldNo) const
 	{
 		using namespace AdHoc::literals;
 		std::stringstream insert;
 		"INSERT INTO %?("_fmt(insert, tableName);
-		unsigned int fieldNo = 0;
 		mp->OnEachChild([this, &fieldNo, &insert](auto && PH1, auto &&, auto && PH3) {
 			createInsertField(fieldNo, insert, PH1, PH3);
 		});
-		insert << ") VALUES (";
-		for (; fieldNo > 1; --fieldNo) {
-			insert << "?, ";
-		}
-		insert << "?)";
-		return connection->modify(std::move(insert).str());
+		insert << ") VALUES ";
+		return std::move(insert).str();
 	}
 
-	void
-	SqlInsertSerializer::createInsertField(
-			unsigned int & fieldNo, std::ostream & insert, const std::string & name, const HookCommon * h) const
+	DB::ModifyCommandPtr
+	SqlInsertSerializer::createInsert(const std::string & prefix, unsigned int fields, unsigned int rows) const
 	{
-		if (isBind(h)) {
-			if (fieldNo++) {
-				insert << ',';
+		std::stringstream insert;
+		insert << prefix;
+		for (unsigned int row = 0; row < rows; ++row) {
+			insert << (row ? ", (" : "(");
+			for (unsigned int fieldNo = fields; fieldNo > 1; --fieldNo) {
+				insert << "?, ";
 			}
-			insert << name;
+			insert << "?)";
 		}
+		return connection->modify(std::move(insert).str());
 	}
 
 	void
-	SqlAutoIdInsertSerializer::createInsertField(
+	SqlInsertSerializer::createInsertField(
 			unsigned int & fieldNo, std::ostream & insert, const std::string & name, const HookCommon * h) const
 	{
-		if (isNotAuto(h)) {
+		if (isInsertField(h)) {
 			if (fieldNo++) {
 				insert << ',';
 			}
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <command_fwd.h>
+#include <cstdint>
+#include <limits>
 #include <ostream>
 #include <slicer/modelParts.h>
 #include <slicer/serializer.h>
@@ -13,16 +15,29 @@ namespace DB {
 }
 
 namespace Slicer {
+	// Limits on how many rows of a sequence are bound into a single multi-row INSERT statement;
+	// the statement is flushed when either limit would be exceeded. The default of one row
+	// keeps the traditional statement per row behaviour.
+	struct SqlInsertBatching {
+		unsigned int maxRows {1};
+		unsigned int maxParams {std::numeric_limits<uint16_t>::max()};
+	};
+
 	class DLL_PUBLIC SqlInsertSerializer : public Slicer::Serializer {
 	public:
-		SqlInsertSerializer(DB::Connection * const, std::string tableName);
+		SqlInsertSerializer(DB::Connection * const, std::string tableName, SqlInsertBatching = {});
 
 		void Serialize(ModelPartForRootParam) override;
 
 	protected:
 		void SerializeObject(ModelPartParam) const;
 		void SerializeSequence(ModelPartParam) const;
+		void SerializeSequenceBatched(ModelPartParam, ModelPartParam) const;
 		[[nodiscard]] DB::ModifyCommandPtr createInsert(ModelPartParam) const;
+		[[nodiscard]] std::string createInsertPrefix(ModelPartParam, unsigned int & fieldNo) const;
+		[[nodiscard]] DB::ModifyCommandPtr createInsert(
+				const std::string & prefix, unsigned int fields, unsigned int rows) const;
+		[[nodiscard]] virtual bool isInsertField(const HookCommon * h) const;
 		virtual void createInsertField(
 				unsigned int & fieldNo, std::ostream & insert, const std::string & name, const HookCommon * h) const;
 		virtual void bindObjectAndExecute(ModelPartParam, DB::ModifyCommand *) const;
@@ -31,6 +46,7 @@ namespace Slicer {
 
 		DB::Connection * const connection;
 		const std::string tableName;
+		const SqlInsertBatching batching;
 	};
 
 	class DLL_PUBLIC SqlAutoIdInsertSerializer : public SqlInsertSerializer {
@@ -38,15 +54,13 @@ namespace Slicer {
 		using SqlInsertSerializer::SqlInsertSerializer;
 
 	protected:
-		void createInsertField(unsigned int & fieldNo, std::ostream & insert, const std::string & name,
-				const HookCommon * h) const override;
-		void bindObjectAndExecuteField(
-				unsigned int & paramNo, DB::ModifyCommand *, ModelPartParam, const HookCommon *) const override;
+		[[nodiscard]] bool isInsertField(const HookCommon * h) const override;
 	};
 
 	class DLL_PUBLIC SqlFetchIdInsertSerializer : public SqlAutoIdInsertSerializer {
 	public:
-		using SqlAutoIdInsertSerializer::SqlAutoIdInsertSerializer;
+		// Each row's generated id is read back, so rows are never batched.
+		SqlFetchIdInsertSerializer(DB::Connection * const, std::string tableName);
 
 	protected:
 		void bindObjectAndExecute(ModelPartParam, DB::ModifyCommand *) const override;
@@ -18,6 +18,12 @@ namespace Slicer {
 		}
 	}
 
+	const void *
+	SqlSource::exchange(ExchangeType t) const
+	{
+		return exchangeFor<Slicer::TValueSource, boost::posix_time::ptime, boost::posix_time::time_duration>(this, t);
+	}
+
 	bool
 	SqlSource::isNull() const
 	{
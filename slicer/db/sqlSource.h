@@ -32,6 +32,7 @@ namespace Slicer {
 		void set(Ice::Float & b) const override;
 		void set(Ice::Double & b) const override;
 		void set(std::string & b) const override;
+		[[nodiscard]] const void * exchange(ExchangeType) const override;
 
 	private:
 		const DB::Column & column;
@@ -1,5 +1,6 @@
 #include "sqlTablePatchSerializer.h"
 #include "sqlCommon.h"
+#include "sqlCopySerializer.h"
 #include "sqlInsertSerializer.h"
 #include <compileTimeFormatter.h>
 #include <connection.h>
@@ -11,8 +12,8 @@
 namespace Slicer {
 	AdHocFormatter(ttname, "slicer_tmp_%?");
 
-	SqlTablePatchSerializer::SqlTablePatchSerializer(DB::Connection * const d, DB::TablePatch & tp) :
-		db(d), tablePatch(tp)
+	SqlTablePatchSerializer::SqlTablePatchSerializer(DB::Connection * const d, DB::TablePatch & tp, Load l) :
+		db(d), tablePatch(tp), load(l)
 	{
 		tablePatch.src = ttname::get(this);
 	}
@@ -28,8 +29,14 @@ namespace Slicer {
 			dropTemporaryTable();
 		});
 
-		SqlInsertSerializer ins(db, tablePatch.src);
-		ins.Serialize(mpr);
+		if (load == Load::Copy) {
+			SqlCopySerializer copy(db, tablePatch.src);
+			copy.Serialize(mpr);
+		}
+		else {
+			SqlInsertSerializer ins(db, tablePatch.src);
+			ins.Serialize(mpr);
+		}
 
 		mpr->OnContained([this](auto && mp) {
 			mp->OnEachChild([this](const auto & name, const auto &, const auto & h) {
@@ -12,7 +12,10 @@ namespace DB {
 namespace Slicer {
 	class DLL_PUBLIC SqlTablePatchSerializer : public Slicer::Serializer {
 	public:
-		SqlTablePatchSerializer(DB::Connection * const, DB::TablePatch &);
+		// How the temporary table is filled before patching.
+		enum class Load { Insert, Copy };
+
+		SqlTablePatchSerializer(DB::Connection * const, DB::TablePatch &, Load = Load::Insert);
 
 		void Serialize(ModelPartForRootParam) override;
 
@@ -22,5 +25,6 @@ namespace Slicer {
 
 		DB::Connection * const db;
 		DB::TablePatch & tablePatch;
+		const Load load;
 	};
 }
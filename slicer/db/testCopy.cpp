@@ -0,0 +1,125 @@
+#define BOOST_TEST_MODULE db_copy
+#include <boost/test/unit_test.hpp>
+
+#include "classes.h"
+#include "collections.h"
+#include "common.h"
+#include "sqlCopySerializer.h"
+#include "sqlSelectDeserializer.h"
+#include "structs.h"
+#include "testMockCommon.h"
+#include "testModels.h"
+#include <Ice/Optional.h>
+#include <connection.h>
+#include <memory>
+#include <slicer/slicer.h>
+#include <string>
+#include <vector>
+// IWYU pragma: no_forward_declare Slicer::UnsupportedModelType
+
+using namespace std::literals;
+
+// LCOV_EXCL_START
+BOOST_TEST_DONT_PRINT_LOG_VALUE(TestModule::DateTime)
+BOOST_TEST_DONT_PRINT_LOG_VALUE(TestModule::IsoDate)
+BOOST_TEST_DONT_PRINT_LOG_VALUE(TestDatabase::Timespan)
+
+// LCOV_EXCL_STOP
+
+namespace std {
+	template<typename T>
+	ostream &
+	operator<<(ostream & s, const Ice::optional<T> &)
+	{
+		return s;
+	}
+}
+
+BOOST_GLOBAL_FIXTURE(StandardMockDatabase);
+
+BOOST_FIXTURE_TEST_SUITE(db, ConnectionFixture)
+
+BOOST_AUTO_TEST_CASE(copy_builtins)
+{
+	TestModule::BuiltInsPtr bi = std::make_shared<TestModule::BuiltIns>(true, 4, 16, 64, 128, 1.2F, 3.4, "text");
+	Slicer::SerializeAny<Slicer::SqlCopySerializer>(bi, db, "builtins");
+	auto sel = db->select("SELECT * FROM builtins");
+	auto bi2 = Slicer::DeserializeAny<Slicer::SqlSelectDeserializer, TestModule::BuiltInsPtr>(sel.get());
+	BOOST_REQUIRE_EQUAL(bi->mbool, bi2->mbool);
+	BOOST_REQUIRE_EQUAL(bi->mbyte, bi2->mbyte);
+	BOOST_REQUIRE_EQUAL(bi->mshort, bi2->mshort);
+	BOOST_REQUIRE_EQUAL(bi->mint, bi2->mint);
+	BOOST_REQUIRE_EQUAL(bi->mlong, bi2->mlong);
+	BOOST_REQUIRE_EQUAL(bi->mfloat, bi2->mfloat);
+	BOOST_REQUIRE_EQUAL(bi->mdouble, bi2->mdouble);
+	BOOST_REQUIRE_EQUAL(bi->mstring, bi2->mstring);
+}
+
+BOOST_AUTO_TEST_CASE(copy_seq_builtins_escaped)
+{
+	TestModule::BuiltInSeq bis = {
+			std::make_shared<TestModule::BuiltIns>(false, 5, 17, 65, 129, 2.3F, 4.5, "tab\there"),
+			std::make_shared<TestModule::BuiltIns>(true, 6, 18, 66, 130, 3.4F, 5.6, "new\nline\r\nand \\N"),
+			std::make_shared<TestModule::BuiltIns>(true, 7, 19, 67, 131, 4.5F, 6.7, "")};
+	Slicer::SerializeAny<Slicer::SqlCopySerializer>(bis, db, "builtins");
+	auto sel = db->select("SELECT * FROM builtins WHERE mint > 64 ORDER BY mint");
+	auto bis2 = Slicer::DeserializeAny<Slicer::SqlSelectDeserializer, TestModule::BuiltInSeq>(sel.get());
+	BOOST_REQUIRE_EQUAL(bis.size(), bis2.size());
+	for (size_t i = 0; i < bis.size(); i++) {
+		BOOST_CHECK_EQUAL(bis[i]->mbool, bis2[i]->mbool);
+		BOOST_CHECK_EQUAL(bis[i]->mbyte, bis2[i]->mbyte);
+		BOOST_CHECK_EQUAL(bis[i]->mshort, bis2[i]->mshort);
+		BOOST_CHECK_EQUAL(bis[i]->mint, bis2[i]->mint);
+		BOOST_CHECK_EQUAL(bis[i]->mlong, bis2[i]->mlong);
+		BOOST_CHECK_EQUAL(bis[i]->mfloat, bis2[i]->mfloat);
+		BOOST_CHECK_EQUAL(bis[i]->mdouble, bis2[i]->mdouble);
+		BOOST_CHECK_EQUAL(bis[i]->mstring, bis2[i]->mstring);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(autocopy_seq_builtinsWithNulls)
+{
+	TestDatabase::BuiltInSeq bis = {
+			std::make_shared<TestDatabase::BuiltIns>(true, IceUtil::None, 17, 0, 129, 2.3, 4.5, "more text"s),
+			std::make_shared<TestDatabase::BuiltIns>(true, 6, 18, 0, 130, 3.4, IceUtil::None, "even more text"s)};
+	Slicer::SerializeAny<Slicer::SqlAutoIdCopySerializer>(bis, db, "builtins");
+	auto sel = db->select("SELECT * FROM builtins WHERE mint IN (1, 2) ORDER BY mint");
+	auto bis2 = Slicer::DeserializeAny<Slicer::SqlSelectDeserializer, TestDatabase::BuiltInSeq>(sel.get());
+	BOOST_REQUIRE_EQUAL(2, bis2.size());
+	BOOST_REQUIRE_EQUAL(bis2.front()->mint, 1);
+	BOOST_REQUIRE_EQUAL(bis2.back()->mint, 2);
+	for (size_t i = 0; i < bis.size(); i++) {
+		BOOST_CHECK_EQUAL(bis[i]->mbool, bis2[i]->mbool);
+		BOOST_CHECK_EQUAL(bis[i]->mbyte, bis2[i]->mbyte);
+		BOOST_CHECK_EQUAL(bis[i]->mshort, bis2[i]->mshort);
+		BOOST_CHECK_EQUAL(bis[i]->mlong, bis2[i]->mlong);
+		BOOST_CHECK_EQUAL(bis[i]->mfloat, bis2[i]->mfloat);
+		BOOST_CHECK_EQUAL(bis[i]->mdouble, bis2[i]->mdouble);
+		BOOST_CHECK_EQUAL(bis[i]->mstring, bis2[i]->mstring);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(copy_converted)
+{
+	TestDatabase::SpecificTypesPtr st
+			= std::make_shared<TestDatabase::SpecificTypes>(TestModule::DateTime {2015, 10, 16, 19, 12, 34},
+					TestModule::IsoDate {2015, 10, 16}, std::make_shared<TestDatabase::Timespan>(1, 2, 3, 4));
+	Slicer::SerializeAny<Slicer::SqlCopySerializer>(st, db, "converted");
+	auto sel = db->select("SELECT * FROM converted");
+	auto st2 = Slicer::DeserializeAny<Slicer::SqlSelectDeserializer, TestDatabase::SpecificTypesPtr>(sel.get());
+	BOOST_REQUIRE_EQUAL(st->date, st2->date);
+	BOOST_REQUIRE_EQUAL(st->dt, st2->dt);
+	BOOST_REQUIRE_EQUAL(st->ts->days, st2->ts->days);
+	BOOST_REQUIRE_EQUAL(st->ts->hours, st2->ts->hours);
+	BOOST_REQUIRE_EQUAL(st->ts->minutes, st2->ts->minutes);
+	BOOST_REQUIRE_EQUAL(st->ts->seconds, st2->ts->seconds);
+}
+
+BOOST_AUTO_TEST_CASE(copy_unsupportedModel)
+{
+	TestModule::ClassMap cm;
+	BOOST_REQUIRE_THROW(
+			Slicer::SerializeAny<Slicer::SqlCopySerializer>(cm, db, "converted"), Slicer::UnsupportedModelType);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
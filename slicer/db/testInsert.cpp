@@ -138,6 +138,55 @@ BOOST_AUTO_TEST_CASE(fetchinsert_seq_builtinsWithNulls)
 	BOOST_REQUIRE_EQUAL(bis.back()->mstring, bis2.back()->mstring);
 }
 
+BOOST_AUTO_TEST_CASE(insert_seq_builtins_batched)
+{
+	TestModule::BuiltInSeq bis;
+	for (Ice::Int i = 1001; i <= 1005; i++) {
+		bis.push_back(std::make_shared<TestModule::BuiltIns>(
+				i % 2 == 0, 7, 19, i, 131, 4.5, 6.7, "batched " + std::to_string(i)));
+	}
+	// 2 rows per statement; 2 full batches and a remainder of 1
+	Slicer::SerializeAny<Slicer::SqlInsertSerializer>(bis, db, "builtins", Slicer::SqlInsertBatching {2});
+	auto sel = db->select("SELECT * FROM builtins WHERE mint > 1000 ORDER BY mint");
+	auto bis2 = Slicer::DeserializeAny<Slicer::SqlSelectDeserializer, TestModule::BuiltInSeq>(sel.get());
+	BOOST_REQUIRE_EQUAL(bis.size(), bis2.size());
+	for (size_t i = 0; i < bis.size(); i++) {
+		BOOST_CHECK_EQUAL(bis[i]->mbool, bis2[i]->mbool);
+		BOOST_CHECK_EQUAL(bis[i]->mbyte, bis2[i]->mbyte);
+		BOOST_CHECK_EQUAL(bis[i]->mshort, bis2[i]->mshort);
+		BOOST_CHECK_EQUAL(bis[i]->mint, bis2[i]->mint);
+		BOOST_CHECK_EQUAL(bis[i]->mlong, bis2[i]->mlong);
+		BOOST_CHECK_EQUAL(bis[i]->mfloat, bis2[i]->mfloat);
+		BOOST_CHECK_EQUAL(bis[i]->mdouble, bis2[i]->mdouble);
+		BOOST_CHECK_EQUAL(bis[i]->mstring, bis2[i]->mstring);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(autoinsert_seq_builtinsWithNulls_batched)
+{
+	TestDatabase::BuiltInSeq bis = {
+			std::make_shared<TestDatabase::BuiltIns>(true, IceUtil::None, 17, 0, 129, 2.3, 4.5, "more text"s),
+			std::make_shared<TestDatabase::BuiltIns>(true, 6, 18, 0, 130, 3.4, IceUtil::None, "even more text"s),
+			std::make_shared<TestDatabase::BuiltIns>(false, 7, 19, 0, 131, 4.5, 5.6, "yet more text"s)};
+	// 7 non-auto fields; the parameter limit allows 2 rows per statement
+	Slicer::SerializeAny<Slicer::SqlAutoIdInsertSerializer>(
+			bis, db, "builtins", Slicer::SqlInsertBatching {10, 14});
+	auto sel = db->select("SELECT * FROM builtins WHERE mint IN (7, 8, 9) ORDER BY mint");
+	auto bis2 = Slicer::DeserializeAny<Slicer::SqlSelectDeserializer, TestDatabase::BuiltInSeq>(sel.get());
+	BOOST_REQUIRE_EQUAL(3, bis2.size());
+	BOOST_REQUIRE_EQUAL(bis2.front()->mint, 7);
+	BOOST_REQUIRE_EQUAL(bis2.back()->mint, 9);
+	for (size_t i = 0; i < bis.size(); i++) {
+		BOOST_CHECK_EQUAL(bis[i]->mbool, bis2[i]->mbool);
+		BOOST_CHECK_EQUAL(bis[i]->mbyte, bis2[i]->mbyte);
+		BOOST_CHECK_EQUAL(bis[i]->mshort, bis2[i]->mshort);
+		BOOST_CHECK_EQUAL(bis[i]->mlong, bis2[i]->mlong);
+		BOOST_CHECK_EQUAL(bis[i]->mfloat, bis2[i]->mfloat);
+		BOOST_CHECK_EQUAL(bis[i]->mdouble, bis2[i]->mdouble);
+		BOOST_CHECK_EQUAL(bis[i]->mstring, bis2[i]->mstring);
+	}
+}
+
 BOOST_AUTO_TEST_CASE(insert_converted)
 {
 	TestDatabase::SpecificTypesPtr st
@@ -51,4 +51,23 @@ BOOST_AUTO_TEST_CASE(insert_builtins)
 	BOOST_REQUIRE_EQUAL(cols, tp.cols);
 }
 
+BOOST_AUTO_TEST_CASE(copy_builtins)
+{
+	TestModule::BuiltInSeq bis = {std::make_shared<TestModule::BuiltIns>(true, 5, 17, 0, 129, 2.3, 4.5, "more text"),
+			std::make_shared<TestModule::BuiltIns>(false, 6, 18, 0, 130, 3.4, 5.6, "changed text"),
+			std::make_shared<TestModule::BuiltIns>(true, 7, 19, 0, 131, 4.5, 6.7, "new text")};
+	DB::TablePatch tp;
+	DB::TransactionScope tx(*db);
+	tp.dest = "builtins";
+	Slicer::SerializeAny<Slicer::SqlTablePatchSerializer>(bis, db, tp, Slicer::SqlTablePatchSerializer::Load::Copy);
+	auto cmd = db->select("SELECT COUNT(*) FROM builtins");
+	auto c = Slicer::DeserializeAny<Slicer::SqlSelectDeserializer, int>(cmd.get());
+	BOOST_REQUIRE_EQUAL(3, c);
+	auto sel = db->select("SELECT mstring FROM builtins WHERE mlong = 130");
+	auto s = Slicer::DeserializeAny<Slicer::SqlSelectDeserializer, std::string>(sel.get());
+	BOOST_REQUIRE_EQUAL("changed text", s);
+	BOOST_REQUIRE_EQUAL(2, tp.pk.size());
+	BOOST_REQUIRE_EQUAL(8, tp.cols.size());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -1,14 +1,29 @@
+#include "sqlCopySerializer.h"
+#include "sqlInsertSerializer.h"
 #include "sqlSelectDeserializer.h"
+#include "sqlTablePatchSerializer.h"
+#include "sqlUpdateSerializer.h"
 #include "testMockCommon.h"
 #include <benchmark/benchmark.h>
 #include <collections.h>
 #include <connection.h>
 #include <definedDirs.h>
 #include <slicer/slicer.h>
+#include <memory>
+#include <string>
+#include <tablepatch.h>
 #include <testModels.h>
 
 const StandardMockDatabase db;
 
+static constexpr Ice::Int BULK_ROWS = 10000;
+
+static void
+bulkSizes(benchmark::internal::Benchmark * b)
+{
+	b->RangeMultiplier(10)->Range(10, BULK_ROWS);
+}
+
 class CoreFixture : public benchmark::Fixture, public ConnectionFixture {
 protected:
 	template<typename Out>
@@ -22,6 +37,68 @@ protected:
 			benchmark::DoNotOptimize(Slicer::DeserializeAny<Slicer::SqlSelectDeserializer, Out>(sel.get()));
 		}
 	}
+
+	static TestModule::BuiltInSeq
+	bulk_rows(Ice::Int rows)
+	{
+		TestModule::BuiltInSeq bis;
+		bis.reserve(static_cast<size_t>(rows));
+		for (Ice::Int s = 1; s <= rows; s++) {
+			bis.push_back(std::make_shared<TestModule::BuiltIns>(
+					s % 2 == 0, 1, 2, s, s, 1.5F, s / 10.0, std::to_string(s)));
+		}
+		return bis;
+	}
+
+	template<typename Serializer, typename... Args>
+	void
+	do_bulk_load(benchmark::State & state, Ice::Int rows, const Args &... args)
+	{
+		db->execute("CREATE TEMPORARY TABLE bulk_builtins AS SELECT * FROM builtins WHERE 1 = 0");
+		const auto bis = bulk_rows(rows);
+		for (auto _ : state) {
+			Slicer::SerializeAny<Serializer>(bis, db, "bulk_builtins", args...);
+			state.PauseTiming();
+			db->execute("TRUNCATE bulk_builtins");
+			state.ResumeTiming();
+		}
+		db->execute("DROP TABLE bulk_builtins");
+		state.SetItemsProcessed(state.iterations() * rows);
+	}
+
+	// Updates every row of a table already holding them, so each iteration does the same work
+	void
+	do_bulk_update(benchmark::State & state, Ice::Int rows)
+	{
+		db->execute("CREATE TEMPORARY TABLE bulk_builtins AS SELECT * FROM builtins WHERE 1 = 0");
+		const auto bis = bulk_rows(rows);
+		Slicer::SerializeAny<Slicer::SqlCopySerializer>(bis, db, "bulk_builtins");
+		for (auto _ : state) {
+			Slicer::SerializeAny<Slicer::SqlUpdateSerializer>(bis, db, "bulk_builtins");
+		}
+		db->execute("DROP TABLE bulk_builtins");
+		state.SetItemsProcessed(state.iterations() * rows);
+	}
+
+	// Patches half the rows in place and inserts the other half
+	void
+	do_bulk_patch(benchmark::State & state, Ice::Int rows, Slicer::SqlTablePatchSerializer::Load load)
+	{
+		db->execute("CREATE TEMPORARY TABLE bulk_builtins AS SELECT * FROM builtins WHERE 1 = 0");
+		const auto bis = bulk_rows(rows);
+		const TestModule::BuiltInSeq existing {bis.begin(), bis.begin() + rows / 2};
+		for (auto _ : state) {
+			state.PauseTiming();
+			db->execute("TRUNCATE bulk_builtins");
+			Slicer::SerializeAny<Slicer::SqlCopySerializer>(existing, db, "bulk_builtins");
+			state.ResumeTiming();
+			DB::TablePatch tp;
+			tp.dest = "bulk_builtins";
+			Slicer::SerializeAny<Slicer::SqlTablePatchSerializer>(bis, db, tp, load);
+		}
+		db->execute("DROP TABLE bulk_builtins");
+		state.SetItemsProcessed(state.iterations() * rows);
+	}
 };
 
 BENCHMARK_F(CoreFixture, bulk_select_complex)(benchmark::State & state)
@@ -34,4 +111,40 @@ BENCHMARK_F(CoreFixture, bulk_select_complex_non_optional)(benchmark::State & st
 	do_bulk_select_complex<TestModule::BuiltInSeq>(state);
 }
 
+BENCHMARK_DEFINE_F(CoreFixture, bulk_insert)(benchmark::State & state)
+{
+	do_bulk_load<Slicer::SqlInsertSerializer>(state, static_cast<Ice::Int>(state.range(1)),
+			Slicer::SqlInsertBatching {static_cast<unsigned int>(state.range(0))});
+}
+
+BENCHMARK_REGISTER_F(CoreFixture, bulk_insert)->ArgsProduct({{1, 10, 100, 1000}, {100, BULK_ROWS}});
+
+BENCHMARK_DEFINE_F(CoreFixture, bulk_copy)(benchmark::State & state)
+{
+	do_bulk_load<Slicer::SqlCopySerializer>(state, static_cast<Ice::Int>(state.range(0)));
+}
+
+BENCHMARK_REGISTER_F(CoreFixture, bulk_copy)->Apply(bulkSizes);
+
+BENCHMARK_DEFINE_F(CoreFixture, bulk_update)(benchmark::State & state)
+{
+	do_bulk_update(state, static_cast<Ice::Int>(state.range(0)));
+}
+
+BENCHMARK_REGISTER_F(CoreFixture, bulk_update)->Apply(bulkSizes);
+
+BENCHMARK_DEFINE_F(CoreFixture, bulk_patch_insert)(benchmark::State & state)
+{
+	do_bulk_patch(state, static_cast<Ice::Int>(state.range(0)), Slicer::SqlTablePatchSerializer::Load::Insert);
+}
+
+BENCHMARK_REGISTER_F(CoreFixture, bulk_patch_insert)->Apply(bulkSizes);
+
+BENCHMARK_DEFINE_F(CoreFixture, bulk_patch_copy)(benchmark::State & state)
+{
+	do_bulk_patch(state, static_cast<Ice::Int>(state.range(0)), Slicer::SqlTablePatchSerializer::Load::Copy);
+}
+
+BENCHMARK_REGISTER_F(CoreFixture, bulk_patch_copy)->Apply(bulkSizes);
+
 BENCHMARK_MAIN();
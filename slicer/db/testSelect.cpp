@@ -17,6 +17,7 @@
 #include <connection.h>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 // IWYU pragma: no_forward_declare Slicer::NoRowsReturned
 // IWYU pragma: no_forward_declare Slicer::TooManyRowsReturned
@@ -133,6 +134,60 @@ BOOST_AUTO_TEST_CASE(select_inherit_sequence)
 	BOOST_REQUIRE_EQUAL(200, d1->b);
 }
 
+BOOST_AUTO_TEST_CASE(select_each_simple)
+{
+	auto sel = db->select("SELECT string \
+				FROM test \
+				ORDER BY id DESC");
+	std::vector<std::string> bi;
+	Slicer::DeserializeEach<Slicer::SqlSelectDeserializer, std::string>(
+			[&bi](std::string && s) {
+				bi.push_back(std::move(s));
+			},
+			sel.get());
+	BOOST_REQUIRE_EQUAL(4, bi.size());
+	BOOST_REQUIRE_EQUAL("text four", bi[0]);
+	BOOST_REQUIRE_EQUAL("text one", bi[3]);
+}
+
+BOOST_AUTO_TEST_CASE(select_each_inherit)
+{
+	auto sel = db->select("SELECT id a, '::TestModule::D' || CAST(id AS TEXT) tc, 200 b, 300 c, 400 d \
+				FROM test \
+				WHERE id < 4 \
+				ORDER BY id DESC");
+	std::vector<Ice::Int> as;
+	Slicer::DeserializeEach<Slicer::SqlSelectDeserializer, TestModule::BasePtr>(
+			[&as](TestModule::BasePtr && b) {
+				BOOST_REQUIRE(b);
+				as.push_back(b->a);
+			},
+			sel.get(), "tc"s);
+	BOOST_REQUIRE_EQUAL(3, as.size());
+	BOOST_REQUIRE_EQUAL(3, as[0]);
+	BOOST_REQUIRE_EQUAL(1, as[2]);
+}
+
+BOOST_AUTO_TEST_CASE(select_projected)
+{
+	auto sel = db->select("SELECT boolean mbool, \
+				id mbyte, id mshort, id mint, id mlong, \
+				fl mdouble, fl mfloat, \
+				string mstring \
+				FROM test \
+				ORDER BY id");
+	auto bi = Slicer::DeserializeProjected<Slicer::SqlSelectDeserializer, TestModule::BuiltInSeq>(
+			{"mint", "mstring"}, sel.get());
+	BOOST_REQUIRE_EQUAL(4, bi.size());
+	BOOST_REQUIRE(bi[0]);
+	BOOST_REQUIRE_EQUAL(1, bi[0]->mint);
+	BOOST_REQUIRE_EQUAL("text one", bi[0]->mstring);
+	BOOST_REQUIRE_EQUAL(false, bi[0]->mbool);
+	BOOST_REQUIRE_EQUAL(0, bi[0]->mlong);
+	BOOST_REQUIRE_EQUAL(0, bi[0]->mdouble);
+	BOOST_REQUIRE_EQUAL(4, bi[3]->mint);
+}
+
 BOOST_AUTO_TEST_CASE(select_inherit_datetime)
 {
 	auto sel = db->select("SELECT dt, to_char(dt, 'YYYY-MM-DD') date, ts \
@@ -3,23 +3,45 @@
 #include <Ice/Initialize.h>
 #include <Ice/InputStream.h>
 #include <Ice/OutputStream.h>
+#include <cerrno>
+#include <cstdlib>
 #include <factory.h>
+#include <fcntl.h>
 #include <istream>
-#include <iterator>
 #include <slicer/modelParts.h>
 #include <slicer/serializer.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <system_error>
+#include <unistd.h>
+#include <utility>
 
 NAMEDFACTORY("application/ice", Slicer::IceStreamSerializer, Slicer::StreamSerializerFactory)
 NAMEDFACTORY("application/ice", Slicer::IceStreamDeserializer, Slicer::StreamDeserializerFactory)
+NAMEDFACTORY(".ice", Slicer::IceFileDeserializer, Slicer::FileDeserializerFactory)
 
 namespace Slicer {
-	IceBase::IceBase() : ic(Ice::initialize()) { }
+	IceBase::IceBase(Ice::CommunicatorPtr c) : ic(c ? std::move(c) : sharedCommunicator()) { }
 
-	IceBase::~IceBase()
+	IceBase::~IceBase() = default;
+
+	const Ice::CommunicatorPtr &
+	IceBase::sharedCommunicator()
 	{
-		ic->destroy();
+		// Leaked deliberately: as a static it could be destructed after Ice's own statics. It's destroyed by an exit
+		// handler instead, registered once Ice is initialised, so it runs before Ice tears itself down.
+		static const Ice::CommunicatorPtr * const shared = [] {
+			const auto ic = new Ice::CommunicatorPtr(Ice::initialize());
+			std::atexit([] {
+				(*shared)->destroy();
+			});
+			return ic;
+		}();
+		return *shared;
 	}
 
+	IceBlobSerializer::IceBlobSerializer(Ice::CommunicatorPtr c) : IceBase(std::move(c)) { }
+
 	void
 	IceBlobSerializer::Serialize(ModelPartForRootParam mp)
 	{
@@ -28,16 +50,28 @@ namespace Slicer {
 		s.finished(blob);
 	}
 
-	IceStreamSerializer::IceStreamSerializer(std::ostream & os) : strm(os) { }
+	IceStreamSerializer::IceStreamSerializer(std::ostream & os, Ice::CommunicatorPtr c) :
+		IceBlobSerializer(std::move(c)), strm(os)
+	{
+	}
 
 	void
 	IceStreamSerializer::Serialize(ModelPartForRootParam mp)
 	{
 		IceBlobSerializer::Serialize(mp);
+		writeBlob();
+	}
+
+	void
+	IceStreamSerializer::writeBlob()
+	{
 		strm.write(reinterpret_cast<const char *>(blob.data()), static_cast<std::streamsize>(blob.size()));
 	}
 
-	IceBlobDeserializer::IceBlobDeserializer(const Ice::ByteSeq & b) : refblob(b) { }
+	IceBlobDeserializer::IceBlobDeserializer(const Ice::ByteSeq & b, Ice::CommunicatorPtr c) :
+		IceBase(std::move(c)), refblob(b)
+	{
+	}
 
 	void
 	IceBlobDeserializer::Deserialize(ModelPartForRootParam mp)
@@ -46,12 +80,98 @@ namespace Slicer {
 		mp->Read(s);
 	}
 
-	IceStreamDeserializer::IceStreamDeserializer(std::istream & is) : IceBlobDeserializer(blob), strm(is) { }
+	IceStreamDeserializer::IceStreamDeserializer(std::istream & is, Ice::CommunicatorPtr c) :
+		IceBlobDeserializer(blob, std::move(c)), strm(is)
+	{
+	}
 
 	void
 	IceStreamDeserializer::Deserialize(ModelPartForRootParam mp)
 	{
-		blob.assign(std::istreambuf_iterator<char>(strm), std::istreambuf_iterator<char>());
+		// Read straight from the buffer in large chunks; this also leaves the stream's state untouched.
+		constexpr std::streamsize CHUNK {1 << 16};
+		auto buf = strm.rdbuf();
+		blob.clear();
+		for (std::streamsize got = CHUNK; got == CHUNK;) {
+			const auto offset = blob.size();
+			blob.resize(offset + CHUNK);
+			got = buf->sgetn(reinterpret_cast<char *>(blob.data() + offset), CHUNK);
+			blob.resize(offset + static_cast<std::size_t>(got));
+		}
 		IceBlobDeserializer::Deserialize(mp);
 	}
+
+	IceSpanDeserializer::IceSpanDeserializer(std::span<const std::byte> d, Ice::CommunicatorPtr c) :
+		IceBase(std::move(c)), data(d)
+	{
+	}
+
+	void
+	IceSpanDeserializer::Deserialize(ModelPartForRootParam mp)
+	{
+		const auto begin = reinterpret_cast<const Ice::Byte *>(data.data());
+		Ice::InputStream s(ic, std::make_pair(begin, begin + data.size()));
+		mp->Read(s);
+	}
+
+	class MappedFile {
+	public:
+		explicit MappedFile(const std::filesystem::path & path) : fd(open(path.c_str(), O_RDONLY | O_CLOEXEC))
+		{
+			if (fd < 0) {
+				throw std::system_error(errno, std::generic_category(), path);
+			}
+			struct stat st { };
+			if (fstat(fd, &st)) {
+				const auto err = errno;
+				close(fd);
+				throw std::system_error(err, std::generic_category(), path);
+			}
+			length = static_cast<std::size_t>(st.st_size);
+			if (length) {
+				addr = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+				if (addr == MAP_FAILED) {
+					const auto err = errno;
+					close(fd);
+					throw std::system_error(err, std::generic_category(), path);
+				}
+				madvise(addr, length, MADV_SEQUENTIAL);
+			}
+		}
+
+		~MappedFile()
+		{
+			if (length) {
+				munmap(addr, length);
+			}
+			close(fd);
+		}
+
+		SPECIAL_MEMBERS_DELETE(MappedFile);
+
+		[[nodiscard]] std::span<const std::byte>
+		span() const
+		{
+			return {static_cast<const std::byte *>(addr), length};
+		}
+
+	private:
+		const int fd;
+		std::size_t length {};
+		void * addr {};
+	};
+
+	IceFileDeserializer::IceFileDeserializer(std::filesystem::path p, Ice::CommunicatorPtr c) :
+		IceSpanDeserializer({}, std::move(c)), path(std::move(p))
+	{
+	}
+
+	void
+	IceFileDeserializer::Deserialize(ModelPartForRootParam mp)
+	{
+		const MappedFile file {path};
+		data = file.span();
+		IceSpanDeserializer::Deserialize(mp);
+		data = {};
+	}
 }
@@ -2,46 +2,127 @@
 
 #include <Ice/BuiltinSequences.h>
 #include <Ice/CommunicatorF.h>
+#include <Ice/OutputStream.h>
+#include <Ice/StreamHelpers.h>
+#include <algorithm>
 #include <c++11Helpers.h>
+#include <cstddef>
+#include <filesystem>
 #include <iosfwd>
 #include <slicer/modelParts.h>
+#include <slicer/parallel.h>
 #include <slicer/serializer.h>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 #include <visibility.h>
 
 namespace Slicer {
+	template<typename Members> struct iceIndependentMembers;
+
+	// Whether the encoding of a T is independent of anything written before it. Class instances aren't: the
+	// second and subsequent occurrences of an instance or type id refer back to the first.
+	template<typename T>
+	[[nodiscard]] consteval bool
+	iceIndependent()
+	{
+		constexpr auto helper = Ice::StreamableTraits<T>::helper;
+		if constexpr (helper == Ice::StreamHelperCategoryBuiltin || helper == Ice::StreamHelperCategoryEnum) {
+			return true;
+		}
+		else if constexpr (helper == Ice::StreamHelperCategorySequence) {
+			return iceIndependent<typename T::value_type>();
+		}
+		else if constexpr (helper == Ice::StreamHelperCategoryDictionary) {
+			return iceIndependent<typename T::key_type>() && iceIndependent<typename T::mapped_type>();
+		}
+		else if constexpr (helper == Ice::StreamHelperCategoryStruct) {
+			return iceIndependentMembers<decltype(std::declval<const T &>().ice_tuple())>::value;
+		}
+		else {
+			return false;
+		}
+	}
+
+	template<typename... Members> struct iceIndependentMembers<std::tuple<Members...>> {
+		static constexpr bool value = (iceIndependent<std::remove_cvref_t<Members>>() && ...);
+	};
+
 	class DLL_PUBLIC IceBase {
 	public:
 		virtual ~IceBase();
 
 		SPECIAL_MEMBERS_DELETE(IceBase);
 
+		// Process-wide communicator used when none is supplied; created on first use.
+		[[nodiscard]] static const Ice::CommunicatorPtr & sharedCommunicator();
+
 	protected:
-		IceBase();
+		explicit IceBase(Ice::CommunicatorPtr);
 
 		Ice::CommunicatorPtr ic;
 	};
 
 	class DLL_PUBLIC IceBlobSerializer : public Serializer, protected IceBase {
 	public:
+		explicit IceBlobSerializer(Ice::CommunicatorPtr = {});
+
 		void Serialize(ModelPartForRootParam) override;
 
+		// Writes the same as serializing seq, with chunks of its elements written concurrently on up to threads
+		// threads (0 for one per core). Only for elements free of class instances, see iceIndependent.
+		template<typename Seq>
+			requires(iceIndependent<typename Seq::value_type>())
+		void
+		SerializeParallel(const Seq & seq, unsigned int threads = 0)
+		{
+			Ice::OutputStream s(ic);
+			s.writeSize(static_cast<Ice::Int>(seq.size()));
+			writeChunksParallel(
+					seq.begin(), seq.end(), threads,
+					[this](auto chunkBegin, auto chunkEnd) {
+						Ice::OutputStream chunk(ic);
+						std::for_each(chunkBegin, chunkEnd, [&chunk](const auto & element) {
+							chunk.write(element);
+						});
+						Ice::ByteSeq elements;
+						chunk.finished(elements);
+						return elements;
+					},
+					[&s](Ice::ByteSeq && elements) {
+						s.writeBlob(elements);
+					});
+			s.finished(blob);
+		}
+
 	protected:
 		Ice::ByteSeq blob;
 	};
 
 	class DLL_PUBLIC IceStreamSerializer : public IceBlobSerializer {
 	public:
-		explicit IceStreamSerializer(std::ostream &);
+		explicit IceStreamSerializer(std::ostream &, Ice::CommunicatorPtr = {});
 
 		void Serialize(ModelPartForRootParam) override;
 
+		template<typename Seq>
+		void
+		SerializeParallel(const Seq & seq, unsigned int threads = 0)
+		{
+			IceBlobSerializer::SerializeParallel(seq, threads);
+			writeBlob();
+		}
+
 	protected:
+		void writeBlob();
+
 		std::ostream & strm;
 	};
 
 	class DLL_PUBLIC IceBlobDeserializer : public Deserializer, protected IceBase {
 	public:
-		explicit IceBlobDeserializer(const Ice::ByteSeq &);
+		explicit IceBlobDeserializer(const Ice::ByteSeq &, Ice::CommunicatorPtr = {});
 
 		void Deserialize(ModelPartForRootParam) override;
 
@@ -51,7 +132,7 @@ namespace Slicer {
 
 	class DLL_PUBLIC IceStreamDeserializer : public IceBlobDeserializer {
 	public:
-		explicit IceStreamDeserializer(std::istream &);
+		explicit IceStreamDeserializer(std::istream &, Ice::CommunicatorPtr = {});
 
 		void Deserialize(ModelPartForRootParam) override;
 
@@ -59,4 +140,26 @@ namespace Slicer {
 		std::istream & strm;
 		Ice::ByteSeq blob;
 	};
+
+	// Reads directly from caller owned memory, which must outlive Deserialize.
+	class DLL_PUBLIC IceSpanDeserializer : public Deserializer, protected IceBase {
+	public:
+		explicit IceSpanDeserializer(std::span<const std::byte>, Ice::CommunicatorPtr = {});
+
+		void Deserialize(ModelPartForRootParam) override;
+
+	protected:
+		std::span<const std::byte> data;
+	};
+
+	// Reads directly from a read-only memory mapping of the file.
+	class DLL_PUBLIC IceFileDeserializer : public IceSpanDeserializer {
+	public:
+		explicit IceFileDeserializer(std::filesystem::path, Ice::CommunicatorPtr = {});
+
+		void Deserialize(ModelPartForRootParam) override;
+
+	protected:
+		const std::filesystem::path path;
+	};
 }
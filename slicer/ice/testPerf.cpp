@@ -0,0 +1,127 @@
+#include "serializer.h"
+#include <Ice/Communicator.h>
+#include <Ice/Initialize.h>
+#include <benchmark/benchmark.h>
+#include <classes.h>
+#include <collections.h>
+#include <cstddef>
+#include <memory>
+#include <slicer/slicer.h>
+#include <span>
+#include <sstream>
+#include <string>
+#include <structs.h>
+
+static const TestModule::IsoDate date {2016, 10, 3};
+
+// Creating and destroying a communicator per call, as every serializer used to.
+static void
+ice_small_struct_own_communicator(benchmark::State & state)
+{
+	for (auto _ : state) {
+		auto ic = Ice::initialize();
+		std::stringstream strm;
+		Slicer::SerializeAny<Slicer::IceStreamSerializer>(date, strm, ic);
+		benchmark::DoNotOptimize(
+				Slicer::DeserializeAny<Slicer::IceStreamDeserializer, TestModule::IsoDate>(strm, ic));
+		ic->destroy();
+	}
+}
+
+BENCHMARK(ice_small_struct_own_communicator);
+
+static void
+ice_small_struct_shared_communicator(benchmark::State & state)
+{
+	for (auto _ : state) {
+		std::stringstream strm;
+		Slicer::SerializeAny<Slicer::IceStreamSerializer>(date, strm);
+		benchmark::DoNotOptimize(Slicer::DeserializeAny<Slicer::IceStreamDeserializer, TestModule::IsoDate>(strm));
+	}
+}
+
+BENCHMARK(ice_small_struct_shared_communicator);
+
+static TestModule::BuiltInSeq
+makeBuiltInSeq(int64_t n)
+{
+	TestModule::BuiltInSeq bis;
+	bis.reserve(static_cast<std::size_t>(n));
+	for (Ice::Int s = 0; s < n; s++) {
+		bis.push_back(std::make_shared<TestModule::BuiltIns>(s % 2 == 0, static_cast<Ice::Byte>(s),
+				static_cast<Ice::Short>(s), s, Ice::Long {s} * 1000, 1.5F, s / 10.0, std::to_string(s)));
+	}
+	return bis;
+}
+
+static void
+ice_builtin_seq_serialize(benchmark::State & state)
+{
+	const auto bis = makeBuiltInSeq(state.range(0));
+	std::size_t bytes {};
+	for (auto _ : state) {
+		std::stringstream strm;
+		Slicer::SerializeAny<Slicer::IceStreamSerializer>(bis, strm);
+		bytes += strm.str().length();
+		benchmark::DoNotOptimize(strm);
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+	state.SetBytesProcessed(static_cast<int64_t>(bytes));
+}
+
+BENCHMARK(ice_builtin_seq_serialize)->RangeMultiplier(10)->Range(1, 10000);
+
+static void
+ice_builtin_seq_deserialize(benchmark::State & state)
+{
+	std::stringstream strm;
+	Slicer::SerializeAny<Slicer::IceStreamSerializer>(makeBuiltInSeq(state.range(0)), strm);
+	const auto blob = strm.str();
+	const auto data = std::as_bytes(std::span {blob});
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(
+				Slicer::DeserializeAny<Slicer::IceSpanDeserializer, TestModule::BuiltInSeq>(data));
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+	state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(blob.size()));
+}
+
+BENCHMARK(ice_builtin_seq_deserialize)->RangeMultiplier(10)->Range(1, 10000);
+
+static void
+ice_builtin_seq_roundtrip(benchmark::State & state)
+{
+	const auto bis = makeBuiltInSeq(state.range(0));
+	for (auto _ : state) {
+		std::stringstream strm;
+		Slicer::SerializeAny<Slicer::IceStreamSerializer>(bis, strm);
+		benchmark::DoNotOptimize(
+				Slicer::DeserializeAny<Slicer::IceStreamDeserializer, TestModule::BuiltInSeq>(strm));
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(ice_builtin_seq_roundtrip)->RangeMultiplier(10)->Range(1, 10000);
+
+// Speed-up of SerializeParallel against thread count; BuiltIns are classes, which can't be chunked, so dates
+static void
+ice_dates_parallel(benchmark::State & state)
+{
+	constexpr Ice::Int elements {1'000'000};
+	TestModule::Dates dates;
+	dates.reserve(elements);
+	for (Ice::Int n {}; n < elements; n++) {
+		dates.push_back({static_cast<Ice::Short>(n % 10000), static_cast<Ice::Short>(1 + n % 12),
+				static_cast<Ice::Short>(1 + n % 28)});
+	}
+	for (auto _ : state) {
+		std::stringstream strm;
+		Slicer::SerializeParallel<Slicer::IceStreamSerializer>(dates, static_cast<unsigned int>(state.range(0)), strm);
+		benchmark::DoNotOptimize(strm);
+	}
+	state.SetItemsProcessed(state.iterations() * elements);
+}
+
+BENCHMARK(ice_dates_parallel)->RangeMultiplier(2)->Range(1, 32)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -2,16 +2,25 @@
 #include <boost/test/unit_test.hpp>
 
 #include "classes.h"
+#include "collections.h"
 #include "serializer.h"
 #include "structs.h"
 #include <Ice/Comparable.h>
+#include <Ice/Communicator.h>
 #include <Ice/Config.h>
+#include <Ice/Initialize.h>
 #include <Ice/Optional.h>
+#include <cstddef>
+#include <definedDirs.h>
+#include <fstream>
 #include <functional>
 #include <iosfwd>
 #include <memory>
 #include <slicer/slicer.h>
+#include <span>
+#include <sstream>
 #include <string>
+#include <system_error>
 #include <typeinfo>
 // IWYU pragma: no_forward_declare Slicer::IceStreamDeserializer
 
@@ -124,3 +133,87 @@ BOOST_AUTO_TEST_CASE(structes)
 	testCompare(date);
 	testCompareOptional(date);
 }
+
+template<typename Seq>
+void
+testParallel(const Seq & seq)
+{
+	std::stringstream sequential;
+	Slicer::SerializeAny<Slicer::IceStreamSerializer>(seq, sequential);
+	for (const auto threads : {1U, 3U, 0U}) {
+		BOOST_TEST_CONTEXT(seq.size() << " elements, " << threads << " threads") {
+			std::stringstream parallel;
+			Slicer::SerializeParallel<Slicer::IceStreamSerializer>(seq, threads, parallel);
+			BOOST_CHECK_EQUAL(sequential.view(), parallel.view());
+			BOOST_CHECK(seq == (Slicer::DeserializeAny<Slicer::IceStreamDeserializer, Seq>(parallel)));
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(parallel)
+{
+	// Either side of the 255 element boundary, where the size's encoding grows
+	for (const Ice::Int size : {0, 1, 254, 255, 1000}) {
+		TestModule::Dates dates;
+		TestModule::SimpleSeq strings;
+		for (Ice::Int n {}; n < size; n++) {
+			dates.push_back({static_cast<Ice::Short>(2000 + n), static_cast<Ice::Short>(1 + n % 12),
+					static_cast<Ice::Short>(1 + n % 28)});
+			strings.push_back(std::string(static_cast<std::size_t>(n % 300), 'x'));
+		}
+		testParallel(dates);
+		testParallel(strings);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(sharedCommunicator)
+{
+	const auto & ic = Slicer::IceBase::sharedCommunicator();
+	BOOST_REQUIRE(ic);
+	BOOST_REQUIRE_EQUAL(ic, Slicer::IceBase::sharedCommunicator());
+}
+
+BOOST_AUTO_TEST_CASE(suppliedCommunicator)
+{
+	auto ic = Ice::initialize();
+	TestModule::IsoDate date({2016, 10, 3});
+	std::stringstream strm;
+	Slicer::SerializeAny<Slicer::IceStreamSerializer>(date, strm, ic);
+	auto date2 = Slicer::DeserializeAny<Slicer::IceStreamDeserializer, TestModule::IsoDate>(strm, ic);
+	BOOST_REQUIRE_EQUAL(date, date2);
+	ic->destroy();
+}
+
+BOOST_AUTO_TEST_CASE(fromSpan)
+{
+	TestModule::IsoDate date({2016, 10, 3});
+	std::stringstream strm;
+	Slicer::SerializeAny<Slicer::IceStreamSerializer>(date, strm);
+	const auto blob = std::move(strm).str();
+	auto date2 = Slicer::DeserializeAny<Slicer::IceSpanDeserializer, TestModule::IsoDate>(
+			std::as_bytes(std::span {blob.data(), blob.size()}));
+	BOOST_REQUIRE_EQUAL(date, date2);
+}
+
+BOOST_AUTO_TEST_CASE(fromFile)
+{
+	TestModule::IsoDate date({2016, 10, 3});
+	const auto path = binDir / "isoDate.ice";
+	{
+		std::ofstream out(path);
+		Slicer::SerializeAny<Slicer::IceStreamSerializer>(date, out);
+	}
+	auto date2 = Slicer::DeserializeAny<Slicer::IceFileDeserializer, TestModule::IsoDate>(path);
+	BOOST_REQUIRE_EQUAL(date, date2);
+
+	auto date3 = Slicer::DeserializeAnyWith<TestModule::IsoDate>(
+			Slicer::FileDeserializerFactory::createNew(".ice", path));
+	BOOST_REQUIRE_EQUAL(date, date3);
+}
+
+BOOST_AUTO_TEST_CASE(fromFileMissing)
+{
+	BOOST_REQUIRE_THROW((Slicer::DeserializeAny<Slicer::IceFileDeserializer, TestModule::IsoDate>(
+								binDir / "missing.ice")),
+			std::system_error);
+}
@@ -1,18 +1,34 @@
 #include "serializer.h"
 #include <Ice/Config.h>
+#include <algorithm>
+#include <array>
 #include <boost/numeric/conversion/cast.hpp>
+#include <charconv>
+#include <cmath>
+#include <compileTimeFormatter.h>
+#include <cstddef>
 #include <factory.h>
 #include <fstream> // IWYU pragma: keep
 #include <functional>
 #include <glibmm/ustring.h>
+#include <istream>
+#include <jsonExceptions.h>
 #include <jsonpp.h>
 #include <map>
 #include <optional>
+#include <ostream>
+#include <slicer/function_ref.h>
 #include <slicer/modelParts.h>
+#include <slicer/parallel.h>
 #include <slicer/serializer.h>
+#include <sstream>
+#include <string>
 #include <string_view>
+#include <tuple>
+#include <type_traits>
 #include <utility>
 #include <variant>
+#include <vector>
 
 NAMEDFACTORY(".js", Slicer::JsonFileSerializer, Slicer::FileSerializerFactory)
 NAMEDFACTORY(".js", Slicer::JsonFileDeserializer, Slicer::FileDeserializerFactory)
@@ -22,16 +38,16 @@ NAMEDFACTORY("application/javascript", Slicer::JsonStreamSerializer, Slicer::Str
 NAMEDFACTORY("application/javascript", Slicer::JsonStreamDeserializer, Slicer::StreamDeserializerFactory)
 NAMEDFACTORY("application/json", Slicer::JsonStreamSerializer, Slicer::StreamSerializerFactory)
 NAMEDFACTORY("application/json", Slicer::JsonStreamDeserializer, Slicer::StreamDeserializerFactory)
+NAMEDFACTORY("application/json+direct", Slicer::JsonDirectStreamSerializer, Slicer::StreamSerializerFactory)
 
 namespace Slicer {
 	namespace {
-		constexpr std::string_view md_object {"json:object"};
 		constexpr std::string_view keyName {"key"};
 		constexpr std::string_view valueName {"value"};
 
 		using namespace std::placeholders;
 
-		class JsonValueSource : public ValueSource {
+		class JsonValueSource : public ValueSource, public TValueSource<std::string_view> {
 		public:
 			explicit JsonValueSource(const json::Value & s) : value(s) { }
 
@@ -83,6 +99,18 @@ namespace Slicer {
 				v = std::get<json::String>(value);
 			}
 
+			void
+			set(std::string_view & v) const override
+			{
+				v = std::get<json::String>(value);
+			}
+
+			[[nodiscard]] const void *
+			exchange(ExchangeType t) const override
+			{
+				return exchangeFor<Slicer::TValueSource, std::string_view>(this, t);
+			}
+
 		private:
 			const json::Value & value;
 		};
@@ -174,7 +202,8 @@ namespace Slicer {
 			{
 				auto apply = [&o](auto && objectModelPart) {
 					objectModelPart->Create();
-					if (objectModelPart->GetMetadata().flagSet(md_object)) {
+					if (objectModelPart->flagSet(MetaFlag::JsonObject)) {
+						objectModelPart->SizeHint(o.size());
 						for (const auto & element : o) {
 							objectModelPart->OnAnonChild([&element](auto && emp, auto &&) {
 								emp->Create();
@@ -219,6 +248,7 @@ namespace Slicer {
 			operator()(const json::Array & a) const
 			{
 				modelPart->Create();
+				modelPart->SizeHint(a.size());
 				for (const auto & element : a) {
 					modelPart->OnAnonChild([&element](auto && emp, auto &&) {
 						visit(emp, element);
@@ -231,6 +261,564 @@ namespace Slicer {
 			ModelPartParam modelPart;
 		};
 
+		// Read only stream buffer over text already in memory
+		class TextBuffer : public std::streambuf {
+		public:
+			explicit TextBuffer(std::string_view text)
+			{
+				auto begin = const_cast<char *>(text.data());
+				setg(begin, begin, begin + text.size());
+			}
+
+		protected:
+			pos_type
+			seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override
+			{
+				const auto from = (dir == std::ios_base::beg) ? eback() : (dir == std::ios_base::cur) ? gptr() : egptr();
+				if (!(which & std::ios_base::in) || off < eback() - from || off > egptr() - from) {
+					return pos_type(off_type(-1));
+				}
+				setg(eback(), from + off, egptr());
+				return gptr() - eback();
+			}
+
+			pos_type
+			seekpos(pos_type pos, std::ios_base::openmode which) override
+			{
+				return seekoff(off_type(pos), std::ios_base::beg, which);
+			}
+		};
+
+		// Pull parser reading JSON tokens directly from a stream buffer
+		class JsonStreamReader {
+		public:
+			explicit JsonStreamReader(std::istream & s) : JsonStreamReader(*s.rdbuf(), 0) { }
+
+			// Reads from part of a larger document, starting offset characters in
+			JsonStreamReader(std::streambuf & b, std::size_t o) :
+				buf(b), offset(static_cast<Ice::Long>(o)), startOffset(offset),
+				startPos(b.pubseekoff(0, std::ios_base::cur, std::ios_base::in))
+			{
+			}
+
+			// A point in an object to read it again from, see rereadObject. Where the buffer can't seek, the text
+			// read from here on is kept while the mark is in scope.
+			class Mark {
+			public:
+				explicit Mark(JsonStreamReader & r) : reader(r), offset(r.offset), outer(r.recording)
+				{
+					if (!reader.seekable()) {
+						reader.recording = &text;
+					}
+				}
+
+				~Mark()
+				{
+					forget();
+				}
+
+				SPECIAL_MEMBERS_DELETE(Mark);
+
+				// Stops keeping text; the object won't be read again
+				void
+				forget()
+				{
+					if (reader.recording == &text) {
+						reader.recording = outer;
+						if (outer) {
+							outer->append(text);
+						}
+					}
+				}
+
+			private:
+				friend JsonStreamReader;
+
+				JsonStreamReader & reader;
+				const Ice::Long offset;
+				std::string * const outer;
+				std::string text;
+			};
+
+			// Calls read with a reader positioned at mark, which reads the rest of the object from there. Where the
+			// buffer can't seek, the rest of the object is skipped first and the kept text is read instead.
+			template<typename Read>
+			void
+			rereadObject(Mark & mark, const Read & read)
+			{
+				if (seekable()) {
+					buf.pubseekpos(startPos + (mark.offset - startOffset), std::ios_base::in);
+					offset = mark.offset;
+					return read(*this);
+				}
+				while (more('}')) {
+					skipString();
+					expect(':');
+					skipValue();
+				}
+				TextBuffer text {mark.text};
+				JsonStreamReader replay {text, static_cast<std::size_t>(mark.offset)};
+				read(replay);
+			}
+
+			// After the top level value, only whitespace may follow
+			void
+			end()
+			{
+				if (peek() != Traits::eof()) {
+					throw BadJsonSyntax(offset);
+				}
+			}
+
+			// Next significant character, not consumed
+			[[nodiscard]] int
+			peek()
+			{
+				auto c = buf.sgetc();
+				while (c == ' ' || c == '\t' || c == '\n' || c == '\r') {
+					bump();
+					c = buf.sgetc();
+				}
+				return c;
+			}
+
+			bool
+			consume(char c)
+			{
+				if (peek() == c) {
+					bump();
+					return true;
+				}
+				return false;
+			}
+
+			void
+			expect(char c)
+			{
+				if (!consume(c)) {
+					throw BadJsonSyntax(offset);
+				}
+			}
+
+			// After a member or element; true if another follows
+			bool
+			more(char close)
+			{
+				if (consume(',')) {
+					return true;
+				}
+				expect(close);
+				return false;
+			}
+
+			[[nodiscard]] std::string
+			readString()
+			{
+				std::string str;
+				expect('"');
+				for (auto c = bump(); c != '"'; c = bump()) {
+					if (c == Traits::eof() || c < 0x20) {
+						throw BadJsonSyntax(offset);
+					}
+					if (c == '\\') {
+						readEscape(str);
+					}
+					else {
+						str += Traits::to_char_type(c);
+					}
+				}
+				return str;
+			}
+
+			[[nodiscard]] std::string
+			readKey()
+			{
+				auto key = readString();
+				expect(':');
+				return key;
+			}
+
+			[[nodiscard]] json::Value
+			readScalar()
+			{
+				switch (peek()) {
+					case '"':
+						return readString();
+					case 't':
+						readWord("true");
+						return true;
+					case 'f':
+						readWord("false");
+						return false;
+					case 'n':
+						readWord("null");
+						return json::Null();
+					default:
+						return readNumber();
+				}
+			}
+
+			void
+			skipValue()
+			{
+				switch (peek()) {
+					case '{':
+						bump();
+						if (!consume('}')) {
+							do {
+								skipString();
+								expect(':');
+								skipValue();
+							} while (more('}'));
+						}
+						break;
+					case '[':
+						bump();
+						if (!consume(']')) {
+							do {
+								skipValue();
+							} while (more(']'));
+						}
+						break;
+					case '"':
+						skipString();
+						break;
+					default:
+						std::ignore = readScalar();
+				}
+			}
+
+		private:
+			using Traits = std::streambuf::traits_type;
+			using pos_type = std::streambuf::pos_type;
+			using off_type = std::streambuf::off_type;
+
+			[[nodiscard]] bool
+			seekable() const
+			{
+				return startPos != pos_type(off_type(-1));
+			}
+
+			int
+			bump()
+			{
+				++offset;
+				const auto c = buf.sbumpc();
+				if (recording && c != Traits::eof()) {
+					*recording += Traits::to_char_type(c);
+				}
+				return c;
+			}
+
+			void
+			skipString()
+			{
+				expect('"');
+				for (auto c = bump(); c != '"'; c = bump()) {
+					if (c == Traits::eof()) {
+						throw BadJsonSyntax(offset);
+					}
+					if (c == '\\') {
+						bump();
+					}
+				}
+			}
+
+			void
+			readWord(std::string_view word)
+			{
+				for (const auto ch : word) {
+					if (bump() != ch) {
+						throw BadJsonSyntax(offset);
+					}
+				}
+			}
+
+			[[nodiscard]] json::Number
+			readNumber()
+			{
+				std::array<char, 64> num {};
+				std::size_t len {};
+				for (auto c = buf.sgetc(); len < num.size() && ((c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E');
+						c = buf.sgetc()) {
+					num[len++] = Traits::to_char_type(bump());
+				}
+				json::Number n {};
+				if (const auto result = std::from_chars(num.data(), num.data() + len, n);
+						len == 0 || result.ec != std::errc {} || result.ptr != num.data() + len) {
+					throw BadJsonSyntax(offset);
+				}
+				return n;
+			}
+
+			[[nodiscard]] char32_t
+			readHex4()
+			{
+				char32_t cp {};
+				for (int i = 0; i < 4; ++i) {
+					const auto c = bump();
+					cp <<= 4U;
+					if (c >= '0' && c <= '9') {
+						cp |= static_cast<char32_t>(c - '0');
+					}
+					else if (c >= 'a' && c <= 'f') {
+						cp |= static_cast<char32_t>(c - 'a' + 10);
+					}
+					else if (c >= 'A' && c <= 'F') {
+						cp |= static_cast<char32_t>(c - 'A' + 10);
+					}
+					else {
+						throw BadJsonSyntax(offset);
+					}
+				}
+				return cp;
+			}
+
+			void
+			readEscape(std::string & str)
+			{
+				switch (const auto c = bump()) {
+					case '"':
+					case '\\':
+					case '/':
+						str += Traits::to_char_type(c);
+						break;
+					case 'b':
+						str += '\b';
+						break;
+					case 'f':
+						str += '\f';
+						break;
+					case 'n':
+						str += '\n';
+						break;
+					case 'r':
+						str += '\r';
+						break;
+					case 't':
+						str += '\t';
+						break;
+					case 'u': {
+						auto cp = readHex4();
+						if (cp >= 0xD800 && cp <= 0xDBFF) {
+							readWord("\\u");
+							const auto low = readHex4();
+							if (low < 0xDC00 || low > 0xDFFF) {
+								throw BadJsonSyntax(offset);
+							}
+							cp = 0x10000 + ((cp - 0xD800) << 10U) + (low - 0xDC00);
+						}
+						appendUtf8(str, cp);
+						break;
+					}
+					default:
+						throw BadJsonSyntax(offset);
+				}
+			}
+
+			static void
+			appendUtf8(std::string & str, char32_t cp)
+			{
+				const auto put = [&str](char32_t b) {
+					str += static_cast<char>(b);
+				};
+				if (cp < 0x80) {
+					put(cp);
+				}
+				else if (cp < 0x800) {
+					put(0xC0 | (cp >> 6U));
+					put(0x80 | (cp & 0x3FU));
+				}
+				else if (cp < 0x10000) {
+					put(0xE0 | (cp >> 12U));
+					put(0x80 | ((cp >> 6U) & 0x3FU));
+					put(0x80 | (cp & 0x3FU));
+				}
+				else {
+					put(0xF0 | (cp >> 18U));
+					put(0x80 | ((cp >> 12U) & 0x3FU));
+					put(0x80 | ((cp >> 6U) & 0x3FU));
+					put(0x80 | (cp & 0x3FU));
+				}
+			}
+
+			std::streambuf & buf;
+			Ice::Long offset {};
+			const Ice::Long startOffset;
+			const pos_type startPos;
+			// Where the innermost unseekable Mark keeps what's read
+			std::string * recording {};
+		};
+
+		[[nodiscard]] BadJsonSyntax
+		syntaxError(std::size_t offset)
+		{
+			return BadJsonSyntax(static_cast<Ice::Long>(offset));
+		}
+
+		// As DocumentTreeIterate, but driven by tokens as they are read from the stream
+		class DocumentStreamIterate {
+		public:
+			static void
+			visit(JsonStreamReader & reader, ModelPartParam modelPart)
+			{
+				switch (reader.peek()) {
+					case '{':
+						return object(reader, modelPart);
+					case '[':
+						return array(reader, modelPart);
+					default:
+						std::visit(DocumentTreeIterate {modelPart}, reader.readScalar());
+				}
+			}
+
+		private:
+			// Reads a value into the child part if the handler is called, otherwise skips it
+			template<typename Read>
+			static void
+			readOrSkip(JsonStreamReader & reader, const Read & read)
+			{
+				bool called {false};
+				read(called);
+				if (!called) {
+					reader.skipValue();
+				}
+			}
+
+			static void
+			object(JsonStreamReader & reader, ModelPartParam modelPart)
+			{
+				reader.expect('{');
+				if (auto typeIdName = modelPart->GetTypeIdProperty(); typeIdName && reader.peek() == '"') {
+					JsonStreamReader::Mark start {reader};
+					auto key = reader.readKey();
+					if (key == *typeIdName && reader.peek() == '"') {
+						start.forget();
+						auto typeId = reader.readString();
+						return modelPart->OnSubclass(
+								[&reader, &key, &typeId](auto && omp) {
+									omp->Create();
+									member(omp, key, json::Value {typeId});
+									members(reader, omp, reader.more('}'));
+								},
+								typeId);
+					}
+					// Look for a later typeId before creating anything, then read the object again as whichever type
+					std::optional<std::string> typeId;
+					for (;;) {
+						if (key == *typeIdName && reader.peek() == '"') {
+							typeId = reader.readString();
+							break;
+						}
+						reader.skipValue();
+						if (!reader.consume(',')) {
+							break;
+						}
+						key = reader.readKey();
+					}
+					return reader.rereadObject(start, [&modelPart, &typeId](JsonStreamReader & from) {
+						if (typeId) {
+							return modelPart->OnSubclass(
+									[&from](auto && omp) {
+										omp->Create();
+										members(from, omp, true);
+									},
+									*typeId);
+						}
+						modelPart->Create();
+						members(from, modelPart, true);
+					});
+				}
+				modelPart->Create();
+				if (modelPart->flagSet(MetaFlag::JsonObject)) {
+					if (!reader.consume('}')) {
+						do {
+							auto key = reader.readKey();
+							readOrSkip(reader, [&reader, &key, &modelPart](bool & called) {
+								modelPart->OnAnonChild([&reader, &key, &called](auto && emp, auto &&) {
+									called = true;
+									emp->Create();
+									emp->OnChild(
+											[&key](auto && kmp, auto &&) {
+												kmp->Create();
+												kmp->SetValue(JsonValueSource(json::Value {key}));
+												kmp->Complete();
+											},
+											keyName);
+									readOrSkip(reader, [&reader, &emp](bool & vcalled) {
+										emp->OnChild(
+												[&reader, &vcalled](auto && vmp, auto &&) {
+													vcalled = true;
+													visit(reader, vmp);
+												},
+												valueName);
+									});
+									emp->Complete();
+								});
+							});
+						} while (reader.more('}'));
+					}
+				}
+				else {
+					members(reader, modelPart, !reader.consume('}'));
+				}
+			}
+
+			static void
+			member(ModelPartParam modelPart, const std::string & key, const json::Value & value)
+			{
+				modelPart->OnChild(
+						[&value](auto && emp, auto &&) {
+							DocumentTreeIterate::visit(emp, value);
+							emp->Complete();
+						},
+						key);
+			}
+
+			// Reads the remaining members of an object and completes it
+			static void
+			members(JsonStreamReader & reader, ModelPartParam modelPart, bool more)
+			{
+				for (; more; more = reader.more('}')) {
+					readMember(reader, modelPart, reader.readKey());
+				}
+				modelPart->Complete();
+			}
+
+			static void
+			readMember(JsonStreamReader & reader, ModelPartParam modelPart, const std::string & key)
+			{
+				readOrSkip(reader, [&reader, &key, &modelPart](bool & called) {
+					modelPart->OnChild(
+							[&reader, &called](auto && emp, auto &&) {
+								called = true;
+								visit(reader, emp);
+								emp->Complete();
+							},
+							key);
+				});
+			}
+
+			static void
+			array(JsonStreamReader & reader, ModelPartParam modelPart)
+			{
+				reader.expect('[');
+				modelPart->Create();
+				if (!reader.consume(']')) {
+					do {
+						readOrSkip(reader, [&reader, &modelPart](bool & called) {
+							modelPart->OnAnonChild([&reader, &called](auto && emp, auto &&) {
+								called = true;
+								visit(reader, emp);
+								emp->Complete();
+							});
+						});
+					} while (reader.more(']'));
+				}
+				modelPart->Complete();
+			}
+		};
+
 		void ModelTreeIterateTo(const std::function<json::Value &()> &, ModelPartParam mp);
 
 		void
@@ -311,7 +899,8 @@ namespace Slicer {
 								if (auto typeId = mp->GetTypeId()) {
 									return mp->OnSubclass(
 											[&oec, &typeIdName, &typeId](auto && lmp) {
-												oec(lmp)->emplace(*typeIdName, *typeId);
+												// Supersedes any member named like it, as in ModelTreeWrite
+												oec(lmp)->insert_or_assign(*typeIdName, *typeId);
 											},
 											*typeId);
 								}
@@ -328,7 +917,7 @@ namespace Slicer {
 						break;
 					case ModelPartType::Dictionary:
 						if (mp->HasValue()) {
-							if (mp->GetMetadata().flagSet(md_object)) {
+							if (mp->flagSet(MetaFlag::JsonObject)) {
 								mp->OnEachChild([&obj = n().emplace<json::Object>()](auto &&, auto && PH2, auto &&) {
 									return ModelTreeIterateDictObj(obj, PH2);
 								});
@@ -343,6 +932,300 @@ namespace Slicer {
 				}
 			}
 		}
+
+		void
+		JsonWriteString(std::ostream & strm, std::string_view str)
+		{
+			constexpr std::string_view hex {"0123456789abcdef"};
+			strm.put('"');
+			std::size_t clean {};
+			for (std::size_t i {}; i < str.length(); ++i) {
+				const auto ch = static_cast<unsigned char>(str[i]);
+				if (ch >= 0x20 && ch != '"' && ch != '\\') {
+					continue;
+				}
+				strm.write(str.data() + clean, static_cast<std::streamsize>(i - clean));
+				clean = i + 1;
+				switch (ch) {
+					case '"':
+						strm.write("\\\"", 2);
+						break;
+					case '\\':
+						strm.write("\\\\", 2);
+						break;
+					case '\b':
+						strm.write("\\b", 2);
+						break;
+					case '\f':
+						strm.write("\\f", 2);
+						break;
+					case '\n':
+						strm.write("\\n", 2);
+						break;
+					case '\r':
+						strm.write("\\r", 2);
+						break;
+					case '\t':
+						strm.write("\\t", 2);
+						break;
+					default: {
+						const std::array<char, 6> esc {'\\', 'u', '0', '0', hex[ch >> 4U], hex[ch & 0xFU]};
+						strm.write(esc.data(), esc.size());
+					}
+				}
+			}
+			strm.write(str.data() + clean, static_cast<std::streamsize>(str.length() - clean));
+			strm.put('"');
+		}
+
+		template<typename Number>
+		void
+		JsonWriteNumber(std::ostream & strm, Number n)
+		{
+			if constexpr (std::is_floating_point_v<Number>) {
+				if (!std::isfinite(n)) {
+					strm.write("null", 4);
+					return;
+				}
+			}
+			std::array<char, 32> buf {};
+			const auto result = std::to_chars(buf.begin(), buf.end(), n);
+			strm.write(buf.data(), result.ptr - buf.data());
+		}
+
+		// Called immediately before a value is written, to emit any separator and/or key
+		using JsonValueStart = function_ref<void()>;
+
+		class JsonStreamTarget : public ValueTarget, public TValueTarget<std::string_view> {
+		public:
+			JsonStreamTarget(std::ostream & s, const JsonValueStart & vs) : strm(s), start(vs) { }
+
+			void
+			get(const bool & value) const override
+			{
+				start();
+				if (value) {
+					strm.write("true", 4);
+				}
+				else {
+					strm.write("false", 5);
+				}
+			}
+
+			void
+			get(const Ice::Byte & value) const override
+			{
+				start();
+				JsonWriteNumber(strm, value);
+			}
+
+			void
+			get(const Ice::Short & value) const override
+			{
+				start();
+				JsonWriteNumber(strm, value);
+			}
+
+			void
+			get(const Ice::Int & value) const override
+			{
+				start();
+				JsonWriteNumber(strm, value);
+			}
+
+			void
+			get(const Ice::Long & value) const override
+			{
+				start();
+				JsonWriteNumber(strm, value);
+			}
+
+			void
+			get(const Ice::Float & value) const override
+			{
+				start();
+				JsonWriteNumber(strm, static_cast<double>(value));
+			}
+
+			void
+			get(const Ice::Double & value) const override
+			{
+				start();
+				JsonWriteNumber(strm, value);
+			}
+
+			void
+			get(const std::string & value) const override
+			{
+				start();
+				JsonWriteString(strm, value);
+			}
+
+			void
+			get(const std::string_view & value) const override
+			{
+				start();
+				JsonWriteString(strm, value);
+			}
+
+			[[nodiscard]] const void *
+			exchange(ExchangeType t) const override
+			{
+				return exchangeFor<Slicer::TValueTarget, std::string_view>(this, t);
+			}
+
+		private:
+			std::ostream & strm;
+			const JsonValueStart & start;
+		};
+
+		class JsonSeparator {
+		public:
+			explicit JsonSeparator(std::ostream & s) : strm(s) { }
+
+			void
+			operator()()
+			{
+				if (!first) {
+					strm.put(',');
+				}
+				first = false;
+			}
+
+			void
+			operator()(std::string_view key)
+			{
+				(*this)();
+				JsonWriteString(strm, key);
+				strm.put(':');
+			}
+
+		private:
+			std::ostream & strm;
+			bool first {true};
+		};
+
+		void ModelTreeWrite(std::ostream &, const JsonValueStart &, ModelPartParam mp);
+
+		void
+		ModelTreeWriteSeq(std::ostream & strm, const JsonValueStart & start, ModelPartParam mp)
+		{
+			start();
+			strm.put('[');
+			JsonSeparator sep {strm};
+			mp->OnEachChild([&strm, &sep](auto &&, auto && emp, auto &&) {
+				if (emp->HasValue()) {
+					ModelTreeWrite(
+							strm,
+							[&sep]() {
+								sep();
+							},
+							emp);
+				}
+			});
+			strm.put(']');
+		}
+
+		void
+		ModelTreeWriteDictObj(std::ostream & strm, const JsonValueStart & start, ModelPartParam mp)
+		{
+			start();
+			strm.put('{');
+			JsonSeparator sep {strm};
+			mp->OnEachChild([&strm, &sep](auto &&, auto && emp, auto &&) {
+				if (!emp->HasValue()) {
+					return;
+				}
+				emp->OnChild(
+						[&strm, &sep, &emp](auto && vmp, auto &&) {
+							ModelTreeWrite(
+									strm,
+									[&sep, &emp]() {
+										json::Object::key_type k;
+										json::Value kv;
+										emp->OnChild(
+												[&kv](auto && kmp, auto &&) {
+													kmp->GetValue(JsonValueTarget(kv));
+												},
+												keyName);
+										JsonValueSource(kv).set(k);
+										sep(k);
+									},
+									vmp);
+						},
+						valueName);
+			});
+			strm.put('}');
+		}
+
+		void
+		ModelTreeWrite(std::ostream & strm, const JsonValueStart & start, ModelPartParam mp)
+		{
+			if (mp) {
+				switch (mp->GetType()) {
+					case ModelPartType::Null:
+						start();
+						strm.write("null", 4);
+						break;
+					case ModelPartType::Simple:
+						mp->GetValue(JsonStreamTarget(strm, start));
+						break;
+					case ModelPartType::Complex:
+						if (mp->HasValue()) {
+							auto oec = [&strm, &start](const auto & lmp, const std::string * typeIdName,
+											   const std::string * typeId) {
+								start();
+								strm.put('{');
+								JsonSeparator sep {strm};
+								if (typeIdName && typeId) {
+									sep(*typeIdName);
+									JsonWriteString(strm, *typeId);
+								}
+								// A member named like the typeId property would duplicate its key; the type id wins,
+								// as it does in ModelTreeIterateTo
+								const std::string * const skip = typeId ? typeIdName : nullptr;
+								lmp->OnEachChild([&strm, &sep, skip](const std::string & name, auto && cmp, auto &&) {
+									if (!name.empty() && !(skip && name == *skip)) {
+										ModelTreeWrite(
+												strm,
+												[&sep, &name]() {
+													sep(name);
+												},
+												cmp);
+									}
+								});
+								strm.put('}');
+							};
+							if (auto typeIdName = mp->GetTypeIdProperty()) {
+								if (auto typeId = mp->GetTypeId()) {
+									return mp->OnSubclass(
+											[&oec, &typeIdName, &typeId](auto && lmp) {
+												oec(lmp, &*typeIdName, &*typeId);
+											},
+											*typeId);
+								}
+							}
+							oec(mp, nullptr, nullptr);
+						}
+						break;
+					case ModelPartType::Sequence:
+						if (mp->HasValue()) {
+							ModelTreeWriteSeq(strm, start, mp);
+						}
+						break;
+					case ModelPartType::Dictionary:
+						if (mp->HasValue()) {
+							if (mp->flagSet(MetaFlag::JsonObject)) {
+								ModelTreeWriteDictObj(strm, start, mp);
+							}
+							else {
+								ModelTreeWriteSeq(strm, start, mp);
+							}
+						}
+						break;
+				}
+			}
+		}
 	}
 
 	JsonStreamSerializer::JsonStreamSerializer(std::ostream & s) : strm(s) { }
@@ -352,11 +1235,106 @@ namespace Slicer {
 	void
 	JsonStreamDeserializer::Deserialize(ModelPartForRootParam modelRoot)
 	{
+		JsonStreamReader reader {strm};
 		modelRoot->OnAnonChild(
-				[this](auto && mp, auto &&) {
-					DocumentTreeIterate::visit(mp, json::parseValue(strm));
+				[&reader](auto && mp, auto &&) {
+					DocumentStreamIterate::visit(reader, mp);
 				},
 				{});
+		reader.end();
+	}
+
+	std::vector<std::string_view>
+	JsonStreamDeserializer::findElements()
+	{
+		std::ostringstream document;
+		document << strm.rdbuf();
+		buffer = std::move(document).str();
+
+		// Only strings and nesting are tracked here; each element is parsed properly when it's read
+		const std::string_view text {buffer};
+		const auto skipSpace = [&text](std::size_t pos) {
+			return std::min(text.find_first_not_of(" \t\n\r", pos), text.size());
+		};
+		// Nothing but whitespace may follow the closing bracket
+		const auto end = [&skipSpace, &text](std::size_t pos) {
+			if (pos = skipSpace(pos + 1); pos != text.size()) {
+				throw syntaxError(pos);
+			}
+		};
+		std::vector<std::string_view> elements;
+		auto pos = skipSpace(0);
+		if (pos == text.size() || text[pos] != '[') {
+			throw syntaxError(pos);
+		}
+		if (pos = skipSpace(pos + 1); pos < text.size() && text[pos] == ']') {
+			end(pos);
+			return elements;
+		}
+		std::size_t depth {};
+		for (auto start = pos; pos < text.size(); ++pos) {
+			switch (text[pos]) {
+				case '"':
+					for (++pos; pos < text.size() && text[pos] != '"'; ++pos) {
+						if (text[pos] == '\\') {
+							++pos;
+						}
+					}
+					break;
+				case '[':
+				case '{':
+					++depth;
+					break;
+				case ']':
+				case '}':
+					if (depth) {
+						--depth;
+						break;
+					}
+					if (text[pos] == '}') {
+						throw syntaxError(pos);
+					}
+					[[fallthrough]];
+				case ',':
+					if (!depth) {
+						elements.emplace_back(text.substr(start, pos - start));
+						if (text[pos] == ']') {
+							end(pos);
+							return elements;
+						}
+						start = pos + 1;
+					}
+					break;
+				default:
+					break;
+			}
+		}
+		throw syntaxError(pos);
+	}
+
+	void
+	JsonStreamDeserializer::readElements(
+			const std::vector<std::string_view> & elements, std::size_t begin, std::size_t end, ModelPartParam chunk) const
+	{
+		const auto first = elements[begin];
+		const auto last = elements[end - 1];
+		const auto offset = [this](std::string_view::const_pointer p) {
+			return static_cast<std::size_t>(p - buffer.data());
+		};
+		TextBuffer text {{first.data(), last.data() + last.size()}};
+		JsonStreamReader reader {text, offset(first.data())};
+		for (auto element = begin; element != end; ++element) {
+			if (element != begin) {
+				reader.expect(',');
+			}
+			chunk->OnAnonChild([&reader](auto && emp, auto &&) {
+				DocumentStreamIterate::visit(reader, emp);
+				emp->Complete();
+			});
+		}
+		if (reader.peek() != std::streambuf::traits_type::eof()) {
+			throw syntaxError(offset(last.data() + last.size()));
+		}
 	}
 
 	void
@@ -366,6 +1344,209 @@ namespace Slicer {
 		json::serializeValue(value, strm, "utf-8");
 	}
 
+	JsonDirectStreamSerializer::JsonDirectStreamSerializer(std::ostream & s) : strm(s) { }
+
+	void
+	JsonDirectStreamSerializer::Serialize(ModelPartForRootParam modelRoot)
+	{
+		bool written {false};
+		modelRoot->OnEachChild([this, &written](auto &&, auto && mp, auto &&) {
+			ModelTreeWrite(
+					strm,
+					[&written]() {
+						written = true;
+					},
+					mp);
+		});
+		if (!written) {
+			strm.write("null", 4);
+		}
+	}
+
+	void
+	JsonDirectStreamSerializer::serializeChunks(const ChunkSource & chunks)
+	{
+		strm.put('[');
+		bool first {true};
+		chunks([this, &first](std::string && elements) {
+			if (!elements.empty()) {
+				// Every element was written after a separator, the very first mustn't be
+				const std::size_t skip {first ? 1U : 0U};
+				strm.write(elements.data() + skip, static_cast<std::streamsize>(elements.size() - skip));
+				first = false;
+			}
+		});
+		strm.put(']');
+	}
+
+	std::string
+	JsonDirectStreamSerializer::writeElements(ModelPartParam chunk)
+	{
+		std::ostringstream elements;
+		chunk->OnEachChild([&elements](auto &&, auto && emp, auto &&) {
+			if (emp->HasValue()) {
+				ModelTreeWrite(
+						elements,
+						[&elements]() {
+							elements.put(',');
+						},
+						emp);
+			}
+		});
+		return std::move(elements).str();
+	}
+
+	JsonStaticWriter::JsonStaticWriter(std::ostream & s) : strm(s) { }
+
+	void
+	JsonStaticWriter::separator()
+	{
+		if (!first.empty()) {
+			if (!first.back()) {
+				strm.put(',');
+			}
+			first.back() = false;
+		}
+	}
+
+	void
+	JsonStaticWriter::beginRoot(const std::string &)
+	{
+	}
+
+	void
+	JsonStaticWriter::endRoot()
+	{
+	}
+
+	void
+	JsonStaticWriter::null()
+	{
+		strm.write("null", 4);
+	}
+
+	void
+	JsonStaticWriter::beginObject()
+	{
+		strm.put('{');
+		first.push_back(true);
+	}
+
+	void
+	JsonStaticWriter::endObject()
+	{
+		first.pop_back();
+		strm.put('}');
+	}
+
+	void
+	JsonStaticWriter::beginMember(const std::string & name)
+	{
+		separator();
+		JsonWriteString(strm, name);
+		strm.put(':');
+	}
+
+	void
+	JsonStaticWriter::endMember()
+	{
+	}
+
+	void
+	JsonStaticWriter::beginArray()
+	{
+		strm.put('[');
+		first.push_back(true);
+	}
+
+	void
+	JsonStaticWriter::endArray()
+	{
+		first.pop_back();
+		strm.put(']');
+	}
+
+	void
+	JsonStaticWriter::beginElement(const std::string &)
+	{
+		separator();
+	}
+
+	void
+	JsonStaticWriter::endElement()
+	{
+	}
+
+	void
+	JsonStaticWriter::value(bool v)
+	{
+		if (v) {
+			strm.write("true", 4);
+		}
+		else {
+			strm.write("false", 5);
+		}
+	}
+
+	void
+	JsonStaticWriter::value(Ice::Byte v)
+	{
+		JsonWriteNumber(strm, v);
+	}
+
+	void
+	JsonStaticWriter::value(Ice::Short v)
+	{
+		JsonWriteNumber(strm, v);
+	}
+
+	void
+	JsonStaticWriter::value(Ice::Int v)
+	{
+		JsonWriteNumber(strm, v);
+	}
+
+	void
+	JsonStaticWriter::value(Ice::Long v)
+	{
+		JsonWriteNumber(strm, v);
+	}
+
+	void
+	JsonStaticWriter::value(Ice::Float v)
+	{
+		JsonWriteNumber(strm, static_cast<double>(v));
+	}
+
+	void
+	JsonStaticWriter::value(Ice::Double v)
+	{
+		JsonWriteNumber(strm, v);
+	}
+
+	void
+	JsonStaticWriter::value(const std::string & v)
+	{
+		JsonWriteString(strm, v);
+	}
+
+	void
+	JsonStaticWriter::fallback(ModelPartParam mp)
+	{
+		ModelTreeWrite(strm, [] {}, mp);
+	}
+
+	void
+	JsonStaticWriter::fallbackMember(const std::string & name, ModelPartParam mp)
+	{
+		ModelTreeWrite(
+				strm,
+				[this, &name]() {
+					beginMember(name);
+				},
+				mp);
+	}
+
 	JsonFileSerializer::JsonFileSerializer(const std::filesystem::path & p) : JsonStreamSerializer {strm}, strm(p) { }
 
 	JsonFileDeserializer::JsonFileDeserializer(std::filesystem::path p) : path(std::move(p)) { }
@@ -374,11 +1555,13 @@ namespace Slicer {
 	JsonFileDeserializer::Deserialize(ModelPartForRootParam modelRoot)
 	{
 		std::ifstream inFile(path);
+		JsonStreamReader reader {inFile};
 		modelRoot->OnAnonChild(
-				[&inFile](auto && mp, auto &&) {
-					DocumentTreeIterate::visit(mp, json::parseValue(inFile));
+				[&reader](auto && mp, auto &&) {
+					DocumentStreamIterate::visit(reader, mp);
 				},
 				{});
+		reader.end();
 	}
 
 	JsonValueDeserializer::JsonValueDeserializer(const json::Value & v) : value(v) { }
@@ -406,4 +1589,12 @@ namespace Slicer {
 					PH2);
 		});
 	}
+
+	AdHocFormatter(BadJsonSyntaxMsg, "Bad JSON syntax at offset [%?]");
+
+	void
+	BadJsonSyntax::ice_print(std::ostream & s) const
+	{
+		BadJsonSyntaxMsg::write(s, offset);
+	}
 }
@@ -1,11 +1,18 @@
 #pragma once
 
 #include <filesystem>
+#include <cstddef>
 #include <fstream>
 #include <iosfwd>
 #include <jsonpp.h>
 #include <slicer/modelParts.h>
+#include <slicer/modelPartsTypes.h>
+#include <slicer/parallel.h>
 #include <slicer/serializer.h>
+#include <slicer/staticSerializer.h>
+#include <string>
+#include <string_view>
+#include <vector>
 #include <visibility.h>
 
 namespace Slicer {
@@ -31,6 +38,74 @@ namespace Slicer {
 		std::ostream & strm;
 	};
 
+	// Writes JSON tokens to the stream as the model is walked, without building a json::Value
+	class DLL_PUBLIC JsonDirectStreamSerializer : public Serializer {
+	public:
+		explicit JsonDirectStreamSerializer(std::ostream &);
+
+		void Serialize(ModelPartForRootParam) override;
+
+		// Writes the same as serializing seq, with chunks of its elements written concurrently on up to threads
+		// threads (0 for one per core)
+		template<typename Seq>
+		void
+		SerializeParallel(const Seq & seq, unsigned int threads = 0)
+		{
+			serializeChunks([&seq, threads](auto && emit) {
+				writeChunksParallel(
+						seq.begin(), seq.end(), threads,
+						[](auto chunkBegin, auto chunkEnd) {
+							return writeElements(ModelPartForSequenceChunk<const Seq> {chunkBegin, chunkEnd});
+						},
+						emit);
+			});
+		}
+
+	protected:
+		void serializeChunks(const ChunkSource &);
+		[[nodiscard]] static std::string writeElements(ModelPartParam chunk);
+
+		std::ostream & strm;
+	};
+
+	// Writes JSON for SerializeStatic, the same as JsonDirectStreamSerializer's output
+	class DLL_PUBLIC JsonStaticWriter : public StaticWriter {
+	public:
+		explicit JsonStaticWriter(std::ostream &);
+
+		void beginRoot(const std::string & name) override;
+		void endRoot() override;
+		void null() override;
+
+		void beginObject() override;
+		void endObject() override;
+		void beginMember(const std::string & name) override;
+		void endMember() override;
+
+		void beginArray() override;
+		void endArray() override;
+		void beginElement(const std::string & name) override;
+		void endElement() override;
+
+		void value(bool) override;
+		void value(Ice::Byte) override;
+		void value(Ice::Short) override;
+		void value(Ice::Int) override;
+		void value(Ice::Long) override;
+		void value(Ice::Float) override;
+		void value(Ice::Double) override;
+		void value(const std::string &) override;
+
+		void fallback(ModelPartParam mp) override;
+		void fallbackMember(const std::string & name, ModelPartParam mp) override;
+
+	protected:
+		void separator();
+
+		std::ostream & strm;
+		std::vector<bool> first;
+	};
+
 	class DLL_PUBLIC JsonFileSerializer : public JsonStreamSerializer {
 	public:
 		explicit JsonFileSerializer(const std::filesystem::path &);
@@ -45,8 +120,36 @@ namespace Slicer {
 
 		void Deserialize(ModelPartForRootParam) override;
 
+		// Reads a top level array into seq, the same as deserializing it; the element boundaries are found
+		// first, then chunks of elements are read concurrently on up to threads threads (0 for one per core)
+		// into pre-sized slots.
+		template<typename Seq>
+		void
+		DeserializeParallel(Seq & seq, unsigned int threads = 0)
+		{
+			const auto elements = findElements();
+			seq.clear();
+			seq.resize(elements.size());
+			SharedClassAllocation allocations;
+			readChunksParallel(elements.size(), threads,
+					[&seq, &elements, &allocations, this](auto chunkBegin, auto chunkEnd) {
+						const ClassAllocation allocation {allocations.arena()};
+						const auto slot = [&seq](auto index) {
+							return seq.begin() + static_cast<typename Seq::difference_type>(index);
+						};
+						readElements(elements, chunkBegin, chunkEnd,
+								ModelPartForSequenceChunk<Seq> {slot(chunkBegin), slot(chunkEnd)});
+					});
+		}
+
 	protected:
+		// Reads the whole document into buffer, returning the text of each of its top level array's elements
+		[[nodiscard]] std::vector<std::string_view> findElements();
+		void readElements(const std::vector<std::string_view> & elements, std::size_t begin, std::size_t end,
+				ModelPartParam chunk) const;
+
 		std::istream & strm;
+		std::string buffer;
 	};
 
 	class DLL_PUBLIC JsonFileDeserializer : public Deserializer {
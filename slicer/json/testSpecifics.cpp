@@ -14,4 +14,5 @@ BOOST_AUTO_TEST_CASE(factories)
 	BOOST_REQUIRE(Slicer::StreamDeserializerFactory::createNew("application/javascript", std::cin));
 	BOOST_REQUIRE(Slicer::StreamSerializerFactory::createNew("application/javascript", std::cout));
 	BOOST_REQUIRE(Slicer::StreamDeserializerFactory::createNew("application/javascript", std::cin));
+	BOOST_REQUIRE(Slicer::StreamSerializerFactory::createNew("application/json+direct", std::cout));
 }
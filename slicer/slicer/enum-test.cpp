@@ -6,7 +6,7 @@ namespace test {
 	enum class Es { one, two, three };
 	const std::string one {"one"}, two {"two"}, three {"three"};
 
-	constexpr Slicer::EnumMapImpl<Es, 3> em {{{
+	constexpr Slicer::EnumMapImpl<Es, 3, 3> em {{{
 			{Es::one, "one", &one},
 			{Es::two, "two", &two},
 			{Es::three, "three", &three},
@@ -23,4 +23,45 @@ namespace test {
 	static_assert(em.find(Es::one)->name == "one");
 	static_assert(em.find(Es::three)->name == "three");
 	static_assert(!em.find("four"));
+	static_assert(!em.find(static_cast<Es>(3)));
+	static_assert(!em.find(static_cast<Es>(-1)));
+
+	enum class Sparse : unsigned char { ten = 10, thirteen = 13, fiftyFive = 55, twelve = 12 };
+	const std::string ten {"ten"}, thirteen {"thirteen"}, fiftyFive {"fiftyFive"}, twelve {"twelve"};
+
+	// Dense, value indexed
+	constexpr Slicer::EnumMapImpl<Sparse, 4, 46> sd {{{
+			{Sparse::ten, "ten", &ten},
+			{Sparse::thirteen, "thirteen", &thirteen},
+			{Sparse::fiftyFive, "fiftyFive", &fiftyFive},
+			{Sparse::twelve, "twelve", &twelve},
+	}}};
+
+	static_assert(sd.arr[0].value == Sparse::ten);
+	static_assert(sd.find("thirteen")->value == Sparse::thirteen);
+	static_assert(sd.find("twelve")->value == Sparse::twelve);
+	static_assert(!sd.find("eleven"));
+	static_assert(!sd.find(""));
+	static_assert(sd.find(Sparse::thirteen)->name == "thirteen");
+	static_assert(sd.find(Sparse::fiftyFive)->name == "fiftyFive");
+	static_assert(!sd.find(static_cast<Sparse>(1)));
+	static_assert(!sd.find(static_cast<Sparse>(11)));
+	static_assert(!sd.find(static_cast<Sparse>(56)));
+
+	// Binary searched by value
+	constexpr Slicer::EnumMapImpl<Sparse, 4, 0> ss {{{
+			{Sparse::ten, "ten", &ten},
+			{Sparse::thirteen, "thirteen", &thirteen},
+			{Sparse::fiftyFive, "fiftyFive", &fiftyFive},
+			{Sparse::twelve, "twelve", &twelve},
+	}}};
+
+	static_assert(ss.find("ten")->value == Sparse::ten);
+	static_assert(ss.find(Sparse::ten)->name == "ten");
+	static_assert(ss.find(Sparse::thirteen)->name == "thirteen");
+	static_assert(ss.find(Sparse::fiftyFive)->name == "fiftyFive");
+	static_assert(ss.find(Sparse::twelve)->name == "twelve");
+	static_assert(!ss.find(static_cast<Sparse>(1)));
+	static_assert(!ss.find(static_cast<Sparse>(11)));
+	static_assert(!ss.find(static_cast<Sparse>(56)));
 }
@@ -1,9 +1,14 @@
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
 #include <string>
 #include <string_view>
+#include <type_traits>
 
 namespace Slicer {
 	template<typename E> class EnumMap {
@@ -14,44 +19,106 @@ namespace Slicer {
 			const std::string * nameStr {};
 		};
 
+		[[nodiscard]] static constexpr inline std::int64_t
+		ordinal(E v) noexcept
+		{
+			return static_cast<std::underlying_type_t<E>>(v);
+		}
+
 		[[nodiscard]] constexpr inline const Node *
 		find(std::string_view v) const noexcept
 		{
-			for (auto b = begin; b != end; b++) {
-				if (b->name == v) {
-					return b;
-				}
-			}
-			return nullptr;
+			const auto e = byName + (end - begin);
+			const auto n = std::lower_bound(byName, e, v, [](const Node * node, std::string_view k) {
+				return node->name < k;
+			});
+			return (n != e && (*n)->name == v) ? *n : nullptr;
 		}
 
 		[[nodiscard]] constexpr inline const Node *
 		find(E v) const noexcept
 		{
-			for (auto b = begin; b != end; b++) {
-				if (b->value == v) {
-					return b;
-				}
+			if (range) {
+				const auto idx = static_cast<std::uint64_t>(ordinal(v) - first);
+				return idx < range ? byValue[idx] : nullptr;
 			}
-			return nullptr;
+			const auto e = byValue + (end - begin);
+			const auto n = std::lower_bound(byValue, e, ordinal(v), [](const Node * node, std::int64_t k) {
+				return ordinal(node->value) < k;
+			});
+			return (n != e && (*n)->value == v) ? *n : nullptr;
+		}
+
+		// All nodes, in declaration order
+		[[nodiscard]] constexpr inline std::span<const Node>
+		nodes() const noexcept
+		{
+			return {begin, end};
 		}
 
 	protected:
 		const Node * begin {};
 		const Node * end {};
+		// Nodes sorted by name
+		const Node * const * byName {};
+		// Indexed by ordinal - first when range is set (nullptr for gaps), otherwise sorted by value
+		const Node * const * byValue {};
+		std::int64_t first {};
+		std::size_t range {};
 	};
 
-	template<typename E, std::size_t N> class EnumMapImpl : public EnumMap<E> {
+	// Range is the number of slots in the value indexed table, which must be max - min + 1 of the enumerator
+	// values; 0 for enumerations too sparse to warrant one, which are binary searched instead.
+	template<typename E, std::size_t N, std::size_t Range> class EnumMapImpl : public EnumMap<E> {
 	public:
 		using NodeType = typename EnumMap<E>::Node;
 		template<std::size_t n> using Arr = std::array<NodeType, n>;
+		template<std::size_t n> using PtrArr = std::array<const NodeType *, n>;
 
 		inline constexpr explicit EnumMapImpl(Arr<N> a) : arr(std::move(a))
 		{
 			EnumMap<E>::begin = arr.begin();
 			EnumMap<E>::end = arr.end();
+
+			std::transform(arr.begin(), arr.end(), byNameArr.begin(), [](const auto & n) {
+				return &n;
+			});
+			std::sort(byNameArr.begin(), byNameArr.end(), [](auto l, auto r) {
+				return l->name < r->name;
+			});
+			EnumMap<E>::byName = byNameArr.data();
+
+			if constexpr (Range > 0) {
+				const auto [lowest, highest]
+						= std::minmax_element(arr.begin(), arr.end(), [](const auto & l, const auto & r) {
+							  return EnumMap<E>::ordinal(l.value) < EnumMap<E>::ordinal(r.value);
+						  });
+				EnumMap<E>::first = lowest == arr.end() ? 0 : EnumMap<E>::ordinal(lowest->value);
+				if (lowest != arr.end()
+						&& static_cast<std::size_t>(EnumMap<E>::ordinal(highest->value) - EnumMap<E>::first) + 1
+								!= Range) {
+					throw std::logic_error("EnumMapImpl Range must span the enumerator values");
+				}
+				for (const auto & n : arr) {
+					byValueArr.at(static_cast<std::size_t>(EnumMap<E>::ordinal(n.value) - EnumMap<E>::first)) = &n;
+				}
+				EnumMap<E>::range = Range;
+			}
+			else {
+				std::transform(arr.begin(), arr.end(), byValueArr.begin(), [](const auto & n) {
+					return &n;
+				});
+				std::sort(byValueArr.begin(), byValueArr.end(), [](auto l, auto r) {
+					return EnumMap<E>::ordinal(l->value) < EnumMap<E>::ordinal(r->value);
+				});
+			}
+			EnumMap<E>::byValue = byValueArr.data();
 		}
 
 		const Arr<N> arr;
+
+	private:
+		PtrArr<N> byNameArr {};
+		PtrArr<Range ? Range : N> byValueArr {};
 	};
 }
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace Slicer {
+	template<typename Sig> class function_ref;
+
+	// Non-owning reference to a callable; it must not outlive what it refers to. Used for the traversal
+	// callbacks, which are only ever invoked during the call they're passed to, to avoid the std::function
+	// wrapping (and frequent heap allocation) per visited node.
+	template<typename R, typename... Args> class function_ref<R(Args...)> {
+	public:
+		inline constexpr function_ref() noexcept = default;
+
+		// cppcheck-suppress noExplicitConstructor
+		// NOLINTNEXTLINE(hicpp-explicit-conversions)
+		inline constexpr function_ref(std::nullptr_t) noexcept { }
+
+		// Compatibility with existing std::function based callers; an empty std::function is an empty reference.
+		// cppcheck-suppress noExplicitConstructor
+		// NOLINTNEXTLINE(hicpp-explicit-conversions)
+		inline function_ref(const std::function<R(Args...)> & f) noexcept :
+			obj {f ? &f : nullptr}, call {f ? &invoke<const std::function<R(Args...)>> : nullptr}
+		{
+		}
+
+		template<typename F>
+			requires(!std::is_same_v<std::remove_cvref_t<F>, function_ref>
+					&& !std::is_same_v<std::remove_cvref_t<F>, std::function<R(Args...)>>
+					&& std::is_invocable_r_v<R, F &, Args...>)
+		// cppcheck-suppress noExplicitConstructor
+		// NOLINTNEXTLINE(hicpp-explicit-conversions,cppcoreguidelines-missing-std-forward)
+		inline constexpr function_ref(F && f) noexcept :
+			obj {std::addressof(f)}, call {&invoke<std::remove_reference_t<F>>}
+		{
+		}
+
+		inline R
+		operator()(Args... args) const
+		{
+			return call(obj, std::forward<Args>(args)...);
+		}
+
+		inline constexpr explicit
+		operator bool() const noexcept
+		{
+			return call;
+		}
+
+	private:
+		template<typename F>
+		static R
+		invoke(const void * o, Args... args)
+		{
+			auto & f = *static_cast<F *>(const_cast<void *>(o));
+			if constexpr (std::is_void_v<R>) {
+				std::invoke(f, std::forward<Args>(args)...);
+			}
+			else {
+				return std::invoke(f, std::forward<Args>(args)...);
+			}
+		}
+
+		const void * obj {};
+		R (*call)(const void *, Args...) {};
+	};
+}
@@ -58,4 +58,10 @@ namespace test {
 	static_assert((laas.begin() + 2)->name == "Aa");
 	static_assert((laas.begin() + 3)->name == "AA");
 	static_assert((laas.begin() + 4) == laas.end());
+
+	static_assert(h.equal_range("AA").begin()->name == "AA");
+	static_assert(std::distance(h.equal_range("b").begin(), h.equal_range("b").end()) == 1);
+	static_assert(std::distance(h.equal_range_lower("b").begin(), h.equal_range_lower("b").end()) == 1);
+	static_assert(h.equal_range_lower("b").begin()->nameStr == &b);
+	static_assert(std::distance(h.equal_range_lower("c").begin(), h.equal_range_lower("c").end()) == 0);
 }
@@ -1,11 +1,14 @@
 #pragma once
 
 #include "modelParts.h"
+#include <algorithm>
 #include <array>
+#include <bit>
 #include <cstddef>
 #include <iterator>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <visibility.h>
 
 namespace Slicer {
@@ -18,8 +21,6 @@ namespace Slicer {
 	public:
 		using HookPtr = const typename ModelPartForComplex<T>::HookBase *;
 
-		class eq;
-
 		class iter {
 		public:
 			using iterator_category = std::bidirectional_iterator_tag;
@@ -28,12 +29,7 @@ namespace Slicer {
 			using pointer = HookPtr *;
 			using reference = HookPtr &;
 
-			[[nodiscard]] constexpr inline explicit iter(const eq * const r) : range(r), cur(r->e) { }
-
-			[[nodiscard]] constexpr inline iter(const eq * const r, const HookPtr * c) : range(r), cur(c)
-			{
-				moveMatch();
-			}
+			[[nodiscard]] constexpr inline explicit iter(const HookPtr * c) : cur(c) { }
 
 			[[nodiscard]] constexpr inline HookPtr
 			operator*() const
@@ -50,19 +46,13 @@ namespace Slicer {
 			constexpr inline void
 			operator++()
 			{
-				if (cur++ != range->e) {
-					moveMatch();
-				}
+				cur++;
 			}
 
 			[[nodiscard]] constexpr inline iter
 			operator+(std::size_t n) const
 			{
-				auto i {*this};
-				while (n--) {
-					++i;
-				}
-				return i;
+				return iter {cur + n};
 			}
 
 			[[nodiscard]] constexpr inline bool
@@ -78,15 +68,6 @@ namespace Slicer {
 			}
 
 		private:
-			constexpr void
-			moveMatch()
-			{
-				while (cur != range->e && (*cur)->*(range->name) != range->key) {
-					cur++;
-				}
-			}
-
-			const eq * const range;
 			const HookPtr * cur;
 		};
 
@@ -95,30 +76,63 @@ namespace Slicer {
 			[[nodiscard]] constexpr inline iter
 			begin() const
 			{
-				return iter {this, b};
+				return iter {b};
 			}
 
 			[[nodiscard]] constexpr inline iter
 			end() const
 			{
-				return iter {this};
+				return iter {e};
 			}
 
-			std::string_view key {};
-			std::string_view HookCommon::*name {};
 			const HookPtr *b {}, *e {};
 		};
 
+		// A run of hooks sharing the same key, in declaration order.
+		struct Bucket {
+			const HookPtr *b {}, *e {};
+		};
+
+		// Open addressed hash table over the runs of a key sorted copy of the hooks.
+		struct Index {
+			[[nodiscard]] constexpr inline eq
+			find(std::string_view k) const
+			{
+				for (auto slot = hash(k) & mask; buckets[slot].b; slot = (slot + 1) & mask) {
+					if ((*buckets[slot].b)->*name == k) {
+						return {buckets[slot].b, buckets[slot].e};
+					}
+				}
+				return {};
+			}
+
+			const Bucket * buckets {};
+			std::size_t mask {};
+			std::string_view HookCommon::*name {};
+		};
+
+		[[nodiscard]] static constexpr inline std::size_t
+		hash(std::string_view k)
+		{
+			// FNV-1a
+			std::size_t h {14695981039346656037ULL};
+			for (const auto c : k) {
+				h ^= static_cast<unsigned char>(c);
+				h *= 1099511628211ULL;
+			}
+			return h;
+		}
+
 		[[nodiscard]] constexpr inline eq
 		equal_range(std::string_view k) const
 		{
-			return {k, &HookCommon::name, _begin, _end};
+			return _byName.find(k);
 		}
 
 		[[nodiscard]] constexpr inline eq
 		equal_range_lower(std::string_view k) const
 		{
-			return {k, &HookCommon::nameLower, _begin, _end};
+			return _byNameLower.find(k);
 		}
 
 		[[nodiscard]] constexpr inline auto
@@ -136,19 +150,55 @@ namespace Slicer {
 	protected:
 		const HookPtr * _begin {};
 		const HookPtr * _end {};
+		Index _byName {};
+		Index _byNameLower {};
 	};
 
 	template<typename T, std::size_t N> class HooksImpl : public Hooks<T> {
 	public:
 		using HookPtr = typename Hooks<T>::HookPtr;
+		using Bucket = typename Hooks<T>::Bucket;
 		template<std::size_t n> using Arr = std::array<HookPtr, n>;
+		static constexpr std::size_t BUCKETS {std::bit_ceil(N * 2)};
+		using Buckets = std::array<Bucket, BUCKETS>;
 
-		inline constexpr explicit HooksImpl(Arr<N> a) : arr(std::move(a))
+		inline constexpr explicit HooksImpl(Arr<N> a) :
+			arr(std::move(a)), byName(arr), byNameLower(arr)
 		{
-			Hooks<T>::_begin = arr.begin();
-			Hooks<T>::_end = arr.end();
+			Hooks<T>::_begin = arr.data();
+			Hooks<T>::_end = arr.data() + N;
+			Hooks<T>::_byName = makeIndex(byName, byNameBuckets, &HookCommon::name);
+			Hooks<T>::_byNameLower = makeIndex(byNameLower, byNameLowerBuckets, &HookCommon::nameLower);
 		}
 
 		const Arr<N> arr;
+
+	private:
+		static constexpr typename Hooks<T>::Index
+		makeIndex(Arr<N> & sorted, Buckets & buckets, std::string_view HookCommon::*name)
+		{
+			// Stable insertion sort; keeps declaration order within each run of equal keys
+			for (std::size_t i = 1; i < N; ++i) {
+				for (auto j = i; j > 0 && sorted[j]->*name < sorted[j - 1]->*name; --j) {
+					std::swap(sorted[j], sorted[j - 1]);
+				}
+			}
+			for (auto b = sorted.data(); b != sorted.data() + N;) {
+				const auto key = (*b)->*name;
+				const auto e = std::find_if(b, sorted.data() + N, [key, name](HookPtr h) {
+					return h->*name != key;
+				});
+				auto slot = Hooks<T>::hash(key) & (BUCKETS - 1);
+				while (buckets[slot].b) {
+					slot = (slot + 1) & (BUCKETS - 1);
+				}
+				buckets[slot] = {b, e};
+				b = e;
+			}
+			return {buckets.data(), BUCKETS - 1, name};
+		}
+
+		Arr<N> byName, byNameLower;
+		Buckets byNameBuckets {}, byNameLowerBuckets {};
 	};
 }
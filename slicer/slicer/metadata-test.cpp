@@ -50,4 +50,28 @@ namespace test {
 	static_assert(md.value("slicer:key:").value() == "id");
 	static_assert(md.value("slicer:key").has_value());
 	static_assert(md.value("slicer:key").value() == "id");
+
+	static_assert(
+			Slicer::MetaData<>::flagOf("xml:attribute") == static_cast<uint32_t>(Slicer::MetaFlag::XmlAttribute));
+	static_assert(
+			Slicer::MetaData<>::flagOf("xml:attributes") == static_cast<uint32_t>(Slicer::MetaFlag::XmlAttributes));
+	static_assert(Slicer::MetaData<>::flagOf("xml") == 0);
+	static_assert(Slicer::MetaData<>::flagOf("chickens") == 0);
+
+	constexpr Slicer::MetaDataImpl<4> mdf {{{
+			"db:pkey",
+			"xml:attribute",
+			"custom:flag",
+			"ignore",
+	}}};
+
+	static_assert(mdf.flagSet(Slicer::MetaFlag::DbPKey));
+	static_assert(mdf.flagSet(Slicer::MetaFlag::XmlAttribute));
+	static_assert(mdf.flagSet(Slicer::MetaFlag::Ignore));
+	static_assert(mdf.flagNotSet(Slicer::MetaFlag::DbAuto));
+	static_assert(mdf.flagNotSet(Slicer::MetaFlag::XmlAttributes));
+	static_assert(mdf.flagNotSet(Slicer::MetaFlag::DbIgnore));
+	static_assert(mdf.flagSet("custom:flag"));
+	static_assert(md.flagNotSet(Slicer::MetaFlag::Ignore));
+	static_assert(Slicer::MetaData<>().flagNotSet(Slicer::MetaFlag::Ignore));
 }
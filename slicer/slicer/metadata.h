@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <optional>
 #include <string_view>
 #include <type_traits>
@@ -11,6 +12,34 @@
 #include <visibility.h>
 
 namespace Slicer {
+	// Well known flags, resolved once from the metadata strings for constant time checks
+	enum class MetaFlag : std::uint32_t {
+		None = 0,
+		Ignore = 1U << 0U,
+		DbIgnore = 1U << 1U,
+		DbPKey = 1U << 2U,
+		DbAuto = 1U << 3U,
+		JsonObject = 1U << 4U,
+		XmlAttribute = 1U << 5U,
+		XmlText = 1U << 6U,
+		XmlBare = 1U << 7U,
+		XmlAttributes = 1U << 8U,
+		XmlElements = 1U << 9U,
+	};
+
+	constexpr std::array<std::pair<std::string_view, MetaFlag>, 10> wellKnownFlags {{
+			{"ignore", MetaFlag::Ignore},
+			{"db:ignore", MetaFlag::DbIgnore},
+			{"db:pkey", MetaFlag::DbPKey},
+			{"db:auto", MetaFlag::DbAuto},
+			{"json:object", MetaFlag::JsonObject},
+			{"xml:attribute", MetaFlag::XmlAttribute},
+			{"xml:text", MetaFlag::XmlText},
+			{"xml:bare", MetaFlag::XmlBare},
+			{"xml:attributes", MetaFlag::XmlAttributes},
+			{"xml:elements", MetaFlag::XmlElements},
+	}};
+
 	template<bool FixedSize = true, typename Value = std::string_view> class DLL_PUBLIC MetaData {
 	public:
 		using Pair = std::pair<Value, std::string_view>;
@@ -32,6 +61,30 @@ namespace Slicer {
 			return find(flag) == _end;
 		}
 
+		[[nodiscard]] constexpr inline bool
+		flagSet(MetaFlag flag) const
+		{
+			return _flags & static_cast<std::uint32_t>(flag);
+		}
+
+		[[nodiscard]] constexpr inline bool
+		flagNotSet(MetaFlag flag) const
+		{
+			return !flagSet(flag);
+		}
+
+		[[nodiscard]] static constexpr inline std::uint32_t
+		flagOf(std::string_view md)
+		{
+			for (const auto & [name, flag] : wellKnownFlags) {
+				// cppcheck-suppress useStlAlgorithm; (not constexpr)
+				if (name == md) {
+					return static_cast<std::uint32_t>(flag);
+				}
+			}
+			return 0;
+		}
+
 		// Values
 		[[nodiscard]] constexpr std::optional<std::string_view>
 		value(std::string_view prefix) const
@@ -103,6 +156,7 @@ namespace Slicer {
 	protected:
 		Iter _begin {};
 		Iter _end {};
+		std::uint32_t _flags {};
 	};
 
 	template<std::size_t N> class DLL_PUBLIC MetaDataImpl : public MetaData<> {
@@ -120,6 +174,9 @@ namespace Slicer {
 		{
 			_begin = arr.begin();
 			_end = arr.end();
+			for (const auto & md : arr) {
+				_flags |= flagOf(md.first);
+			}
 		}
 
 		Arr arr;
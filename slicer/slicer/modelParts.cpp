@@ -12,6 +12,11 @@ namespace Slicer {
 	{
 	}
 
+	void
+	ModelPart::SizeHint(std::size_t)
+	{
+	}
+
 	void
 	ModelPart::OnSubclass(const ModelPartHandler &, const std::string &)
 	{
@@ -47,6 +52,12 @@ namespace Slicer {
 		return emptyMetadata;
 	}
 
+	bool
+	ModelPart::flagSet(MetaFlag flag) const
+	{
+		return GetMetadata().flagSet(flag);
+	}
+
 	bool
 	ModelPart::IsOptional() const
 	{
@@ -1,9 +1,12 @@
 #pragma once
 
 #include "any_ptr.h"
+#include "function_ref.h"
 #include "metadata.h"
 #include <Ice/Config.h>
 #include <c++11Helpers.h>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <optional>
 #include <string>
@@ -15,7 +18,37 @@ namespace Ice {
 	class OutputStream;
 }
 
+namespace boost::posix_time {
+	class ptime;
+	class time_duration;
+}
+
 namespace Slicer {
+	// Exchange types beyond the builtins which a ValueSource/ValueTarget may also support. Converted model
+	// parts look these up by tag rather than by a dynamic_cast per configured conversion.
+	enum class ExchangeType : uint8_t {
+		None,
+		PosixTime,
+		TimeDuration,
+		StringView,
+	};
+
+	template<typename T> constexpr ExchangeType exchangeTypeOf {ExchangeType::None};
+	template<> constexpr ExchangeType exchangeTypeOf<boost::posix_time::ptime> {ExchangeType::PosixTime};
+	template<> constexpr ExchangeType exchangeTypeOf<boost::posix_time::time_duration> {ExchangeType::TimeDuration};
+	// Text viewed in place; a source's view remains valid for the lifetime of the source.
+	template<> constexpr ExchangeType exchangeTypeOf<std::string_view> {ExchangeType::StringView};
+
+	// Helper for implementing ValueSource/ValueTarget::exchange; returns self's TV<T> for whichever T is tagged t.
+	template<template<typename> typename TV, typename... T, typename Self>
+	[[nodiscard]] inline const void *
+	exchangeFor(const Self * self, ExchangeType t)
+	{
+		const void * rtn {};
+		((t == exchangeTypeOf<T> && (rtn = static_cast<const TV<T> *>(self))) || ...);
+		return rtn;
+	}
+
 	template<typename T> class TValueTarget {
 	public:
 		constexpr TValueTarget() = default;
@@ -42,6 +75,13 @@ namespace Slicer {
 		using TValueTarget<Ice::Float>::get;
 		using TValueTarget<Ice::Double>::get;
 		using TValueTarget<std::string>::get;
+
+		// The TValueTarget<T> for the non-builtin exchange type tagged t, if supported.
+		[[nodiscard]] virtual const void *
+		exchange(ExchangeType) const
+		{
+			return nullptr;
+		}
 	};
 
 	template<typename T> class TValueSource {
@@ -70,8 +110,44 @@ namespace Slicer {
 		using TValueSource<Ice::Float>::set;
 		using TValueSource<Ice::Double>::set;
 		using TValueSource<std::string>::set;
+
+		// The TValueSource<T> for the non-builtin exchange type tagged t, if supported.
+		[[nodiscard]] virtual const void *
+		exchange(ExchangeType) const
+		{
+			return nullptr;
+		}
 	};
 
+	// Calls f with the text of s, viewed in place if s supports ExchangeType::StringView, copied out otherwise.
+	template<typename F>
+	inline void
+	setView(const ValueSource & s, const F & f)
+	{
+		if (auto view = static_cast<const TValueSource<std::string_view> *>(s.exchange(ExchangeType::StringView))) {
+			std::string_view v;
+			view->set(v);
+			f(v);
+		}
+		else {
+			std::string v;
+			s.set(v);
+			f(v);
+		}
+	}
+
+	// Passes v to t, in place if t supports ExchangeType::StringView, as a copy otherwise.
+	inline void
+	getView(const ValueTarget & t, std::string_view v)
+	{
+		if (auto view = static_cast<const TValueTarget<std::string_view> *>(t.exchange(ExchangeType::StringView))) {
+			view->get(v);
+		}
+		else {
+			t.get(std::string {v});
+		}
+	}
+
 	class ModelPart;
 	class ModelPartForRootBase;
 	class HookCommon;
@@ -84,13 +160,15 @@ namespace Slicer {
 
 	using ModelPartParam = any_ptr<ModelPart>;
 	using ModelPartForRootParam = any_ptr<ModelPartForRootBase>;
-	using TypeId = std::optional<std::string>;
+	// The exchange type name of a subclass instance, null otherwise; owned by the class registry, or by whatever
+	// overrides GetTypeId, which must keep it alive for as long as the model part
+	using TypeId = const std::string *;
 	using Metadata = MetaData<>;
-	using ChildHandler = std::function<void(const std::string &, ModelPartParam, const HookCommon *)>;
-	using ModelPartHandler = std::function<void(ModelPartParam)>;
-	using ModelPartRootHandler = std::function<void(ModelPartForRootParam)>;
-	using SubPartHandler = std::function<void(ModelPartParam, const Metadata &)>;
-	using HookFilter = std::function<bool(const HookCommon *)>;
+	using ChildHandler = function_ref<void(const std::string &, ModelPartParam, const HookCommon *)>;
+	using ModelPartHandler = function_ref<void(ModelPartParam)>;
+	using ModelPartRootHandler = function_ref<void(ModelPartForRootParam)>;
+	using SubPartHandler = function_ref<void(ModelPartParam, const Metadata &)>;
+	using HookFilter = function_ref<bool(const HookCommon *)>;
 	constexpr Metadata emptyMetadata;
 
 	enum class ModelPartType {
@@ -124,6 +202,12 @@ namespace Slicer {
 
 		[[nodiscard]] virtual const Metadata & GetMetadata() const = 0;
 
+		[[nodiscard]] inline bool
+		flagSet(MetaFlag flag) const
+		{
+			return GetMetadata().flagSet(flag);
+		}
+
 		std::string_view name;
 		std::string_view nameLower;
 		const std::string * nameStr;
@@ -150,10 +234,13 @@ namespace Slicer {
 		[[nodiscard]] virtual ModelPartType GetType() const = 0;
 		virtual void Create();
 		virtual void Complete();
+		// The number of children a deserializer is about to add, when known up front; lets containers reserve
+		virtual void SizeHint(std::size_t);
 		virtual void SetValue(ValueSource &&);
 		virtual bool GetValue(ValueTarget &&);
 		[[nodiscard]] virtual bool HasValue() const = 0;
 		[[nodiscard]] virtual const Metadata & GetMetadata() const;
+		[[nodiscard]] bool flagSet(MetaFlag flag) const;
 		[[nodiscard]] virtual bool IsOptional() const;
 		virtual void OnContained(const ModelPartHandler &);
 
@@ -4,21 +4,23 @@
 #include "modelPartsTypes.impl.h"
 #include <Ice/Config.h>
 #include <Ice/Optional.h>
+#include <atomic>
 #include <boost/algorithm/string/predicate.hpp>
-#include <boost/multi_index/indexed_by.hpp>
-#include <boost/multi_index/member.hpp>
-#include <boost/multi_index/ordered_index.hpp>
-#include <boost/multi_index_container.hpp>
+#include <cstddef>
 #include <cstdlib>
-#include <functional>
+#include <list>
 #include <map>
 #include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <string_view>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
 #include <utility>
-
-// IWYU pragma: no_forward_declare boost::multi_index::member
-// IWYU pragma: no_include <boost/operators.hpp>
+#include <vector>
 
 namespace Ice {
 	class InputStream;
@@ -30,38 +32,180 @@ namespace Slicer {
 	static_assert(isOptional<::Ice::optional<int>>::value);
 	static_assert(isOptional<::IceUtil::Optional<int>>::value);
 
-	using ClassRefMap = std::map<std::string, const ClassRefBase *, std::less<>>;
-	using ClassNamePair = std::pair<std::string_view, std::string>;
-	using ClassNameMap = boost::multi_index_container<ClassNamePair,
-			boost::multi_index::indexed_by<
-					boost::multi_index::ordered_unique<
-							boost::multi_index::member<ClassNamePair, const std::string_view, &ClassNamePair::first>,
-							std::less<>>,
-					boost::multi_index::ordered_unique<
-							boost::multi_index::member<ClassNamePair, const std::string, &ClassNamePair::second>,
-							std::less<>>>>;
-
 	namespace {
-		constinit std::unique_ptr<ClassNameMap> names;
-		constinit std::unique_ptr<ClassRefMap> refs;
-
-		void createClassMaps() __attribute__((constructor(208)));
+		// A registered class, or the registered class (if any) an unregistered type was found to stand for, such as a
+		// slicer:implementation of one
+		struct ClassRegistration {
+			// Owned, as a class's own name would go with its library should that be unloaded
+			std::string className;
+			std::string exchangeName;
+			const ClassRefBase * ref;
+			bool registered;
+		};
+
+		struct ClassTables {
+			std::unordered_map<std::string_view, const ClassRegistration *> byClassName;
+			std::unordered_map<std::string_view, const ClassRegistration *> byExchangeName;
+			std::unordered_map<std::type_index, const ClassRegistration *> byType;
+		};
+
+		// Classes register as their library loads, i.e. almost always during static initialisation; the lookup
+		// tables are built on first use after any change and then read without locking. Replaced tables and
+		// registrations are kept, as other threads may still be reading them. Aliases are just a cache of what
+		// unregistered types stand for, so they're forgotten whenever a library unloads, along with any of its
+		// types that were among them.
+		class ClassRegistry {
+		public:
+			[[nodiscard]] const ClassTables &
+			tables()
+			{
+				if (const auto current = published.load(std::memory_order_acquire)) [[likely]] {
+					return *current;
+				}
+				const std::lock_guard guard {lock};
+				return publish();
+			}
+
+			void
+			add(std::string_view className, std::optional<std::string_view> typeName, const ClassRefBase * ref,
+					const std::type_info & type)
+			{
+				const std::lock_guard guard {lock};
+				const auto & registration = registrations.emplace_back(
+						std::string {className}, std::string {typeName.value_or(className)}, ref, true);
+				types.insert_or_assign(type, &registration);
+				published.store(nullptr, std::memory_order_release);
+			}
+
+			void
+			remove(std::string_view className)
+			{
+				const std::lock_guard guard {lock};
+				std::erase_if(types, [className](const auto & type) {
+					return type.second->className == className;
+				});
+				aliases.clear();
+				for (auto & registration : registrations) {
+					if (registration.className == className) {
+						registration.registered = false;
+					}
+				}
+				published.store(nullptr, std::memory_order_release);
+			}
+
+			// Remembers that type stands for the class identified by id
+			[[nodiscard]] const ClassRegistration &
+			alias(const std::type_info & type, const std::string & id)
+			{
+				const std::lock_guard guard {lock};
+				const auto & current = publish();
+				const auto registered = current.byClassName.find(id);
+				const auto & registration = (registered != current.byClassName.end())
+						? *registered->second
+						: registrations.emplace_back(std::string {}, id, nullptr, false);
+				aliases.insert_or_assign(type, &registration);
+				published.store(nullptr, std::memory_order_release);
+				return registration;
+			}
+
+		private:
+			// With lock held
+			const ClassTables &
+			publish()
+			{
+				if (const auto current = published.load(std::memory_order_acquire)) {
+					return *current;
+				}
+				auto & next = *built.emplace_back(std::make_unique<ClassTables>());
+				for (const auto & registration : registrations) {
+					if (registration.registered) {
+						next.byClassName.emplace(registration.className, &registration);
+						next.byExchangeName.emplace(registration.exchangeName, &registration);
+					}
+				}
+				next.byType.insert(types.begin(), types.end());
+				next.byType.insert(aliases.begin(), aliases.end());
+				published.store(&next, std::memory_order_release);
+				return next;
+			}
+
+			std::mutex lock;
+			std::list<ClassRegistration> registrations;
+			std::map<std::type_index, const ClassRegistration *> types;
+			std::map<std::type_index, const ClassRegistration *> aliases;
+			std::vector<std::unique_ptr<ClassTables>> built;
+			std::atomic<const ClassTables *> published {};
+		};
+
+		constinit std::unique_ptr<ClassRegistry> registry;
+		// See ClassAllocation
+		constinit thread_local std::pmr::memory_resource * classResource {};
+
+		void createClassRegistry() __attribute__((constructor(208)));
 
 		void
-		createClassMaps()
+		createClassRegistry()
 		{
-			names = std::make_unique<ClassNameMap>();
-			refs = std::make_unique<ClassRefMap>();
+			registry = std::make_unique<ClassRegistry>();
 		}
 	}
 
+	ClassAllocation::ClassAllocation(std::pmr::memory_resource * resource) : previous(classResource)
+	{
+		classResource = resource;
+	}
+
+	ClassAllocation::~ClassAllocation()
+	{
+		classResource = previous;
+	}
+
+	std::pmr::memory_resource *
+	ClassAllocation::current()
+	{
+		return classResource;
+	}
+
+	SharedClassAllocation::SharedClassAllocation() : resource(ClassAllocation::current()) { }
+
+	std::pmr::memory_resource *
+	SharedClassAllocation::arena()
+	{
+		if (!resource) {
+			return nullptr;
+		}
+		const std::lock_guard guard {lock};
+		// Not deleted, see SharedClassAllocation; releasing it would release the instances allocated from it
+		return std::pmr::polymorphic_allocator<> {resource}.new_object<std::pmr::monotonic_buffer_resource>(
+				static_cast<std::pmr::memory_resource *>(this));
+	}
+
+	void *
+	SharedClassAllocation::do_allocate(std::size_t bytes, std::size_t alignment)
+	{
+		const std::lock_guard guard {lock};
+		return resource->allocate(bytes, alignment);
+	}
+
+	void
+	SharedClassAllocation::do_deallocate(void * p, std::size_t bytes, std::size_t alignment)
+	{
+		const std::lock_guard guard {lock};
+		resource->deallocate(p, bytes, alignment);
+	}
+
+	bool
+	SharedClassAllocation::do_is_equal(const std::pmr::memory_resource & other) const noexcept
+	{
+		return this == &other;
+	}
+
 	std::string_view
 	ModelPartForComplexBase::ToModelTypeName(const std::string & name)
 	{
-		const auto & right = names->get<1>();
-
-		if (const auto mapped = right.find(name); mapped != right.end()) {
-			return mapped->first;
+		const auto & tables = registry->tables();
+		if (const auto mapped = tables.byExchangeName.find(name); mapped != tables.byExchangeName.end()) {
+			return mapped->second->className;
 		}
 		return name;
 	}
@@ -69,10 +213,9 @@ namespace Slicer {
 	const std::string &
 	ModelPartForComplexBase::ToExchangeTypeName(const std::string & name)
 	{
-		const auto & left = names->get<0>();
-
-		if (const auto mapped = left.find(name); mapped != left.end()) {
-			return mapped->second;
+		const auto & tables = registry->tables();
+		if (const auto mapped = tables.byClassName.find(name); mapped != tables.byClassName.end()) {
+			return mapped->second->exchangeName;
 		}
 		return name;
 	}
@@ -206,40 +349,39 @@ namespace Slicer {
 	const ModelPartType ModelPartForComplexBase::type = ModelPartType::Complex;
 
 	void
-	ModelPartForComplexBase::registerClass(
-			const std::string_view className, const std::optional<std::string_view> typeName, const ClassRefBase * cr)
+	ModelPartForComplexBase::registerClass(const std::string_view className,
+			const std::optional<std::string_view> typeName, const ClassRefBase * cr, const std::type_info & type)
 	{
-		refs->emplace(className, cr);
-		if (typeName) {
-			names->emplace(className, *typeName);
-		}
+		registry->add(className, typeName, cr, type);
 	}
 
 	void
-	ModelPartForComplexBase::unregisterClass(
-			const std::string_view className, const std::optional<std::string_view> typeName)
+	ModelPartForComplexBase::unregisterClass(const std::string_view className)
 	{
-		if (const auto i = refs->find(className); i != refs->end()) {
-			refs->erase(i);
-		}
-		if (typeName) {
-			names->get<0>().erase(className);
-		}
+		registry->remove(className);
 	}
 
 	const ClassRefBase *
 	ModelPartForComplexBase::getSubclassRef(const std::string & name)
 	{
-		if (const auto ref = refs->find(ToModelTypeName(name)); ref != refs->end()) {
-			return ref->second;
+		const auto & tables = registry->tables();
+		if (const auto mapped = tables.byExchangeName.find(name); mapped != tables.byExchangeName.end()) {
+			return mapped->second->ref;
+		}
+		if (const auto ref = tables.byClassName.find(name); ref != tables.byClassName.end()) {
+			return ref->second->ref;
 		}
 		throw UnknownType(name);
 	}
 
 	TypeId
-	ModelPartForComplexBase::getTypeId(const std::string & id, const std::string_view className)
+	ModelPartForComplexBase::getTypeId(
+			const std::type_info & type, const function_ref<std::string()> & id, const std::string_view className)
 	{
-		return (id == className) ? TypeId() : ToExchangeTypeName(id);
+		const auto & tables = registry->tables();
+		const auto found = tables.byType.find(type);
+		const auto & registration = (found != tables.byType.end()) ? *found->second : registry->alias(type, id());
+		return (registration.className == className) ? nullptr : &registration.exchangeName;
 	}
 
 	void
@@ -258,6 +400,14 @@ namespace Slicer {
 		}
 	}
 
+	void
+	ModelPartForOptionalBase::SizeHint(std::size_t size)
+	{
+		if (this->hasModel()) {
+			modelPart->SizeHint(size);
+		}
+	}
+
 	bool
 	ModelPartForOptionalBase::OnAnonChild(const SubPartHandler & h, const HookFilter & flt)
 	{
@@ -312,6 +462,14 @@ namespace Slicer {
 		return modelPart->GetMetadata();
 	}
 
+	void
+	ModelPartForOptionalBase::OnContained(const ModelPartHandler & h)
+	{
+		if (this->hasModel()) {
+			h(modelPart);
+		}
+	}
+
 	bool
 	ModelPartForEnumBase::HasValue() const
 	{
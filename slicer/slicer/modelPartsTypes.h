@@ -6,9 +6,15 @@
 #include <cstddef>
 #include <functional>
 #include <memory>
+#include <memory_resource>
+#include <mutex>
 #include <optional>
+#include <span>
 #include <string>
 #include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
 #include <visibility.h>
 
 namespace Ice {
@@ -83,6 +89,8 @@ namespace Slicer {
 		inline static TryConvertResult tryConvertTo(const ValueTarget & vsp, const MT * model, const Conv & conv);
 		template<typename ET, typename MT>
 		inline static TryConvertResult tryConvertTo(const ValueTarget & vsp, const MT * model);
+		template<typename ET> inline static const TValueSource<ET> * exchangeSource(const ValueSource & vsp);
+		template<typename ET> inline static const TValueTarget<ET> * exchangeTarget(const ValueTarget & vtp);
 	};
 
 	template<typename T, typename M, T M::*MV>
@@ -114,6 +122,7 @@ namespace Slicer {
 	public:
 		void OnEachChild(const ChildHandler & ch) override;
 		void Complete() override;
+		void SizeHint(std::size_t) override;
 		bool OnAnonChild(const SubPartHandler &, const HookFilter & flt) override;
 		bool OnChild(const SubPartHandler &, std::string_view name, const HookFilter & flt,
 				MatchCase matchCase = MatchCase::Yes) override;
@@ -122,6 +131,7 @@ namespace Slicer {
 		[[nodiscard]] bool HasValue() const override;
 		[[nodiscard]] bool IsOptional() const override;
 		[[nodiscard]] const Metadata & GetMetadata() const override;
+		void OnContained(const ModelPartHandler &) override;
 
 	protected:
 		[[nodiscard]] virtual bool hasModel() const = 0;
@@ -151,11 +161,15 @@ namespace Slicer {
 	protected:
 		const ClassRefBase * getSubclassRef(const std::string & name);
 
-		static void registerClass(
-				const std::string_view className, const std::optional<std::string_view> typeName, const ClassRefBase *);
-		static void unregisterClass(const std::string_view className, const std::optional<std::string_view> typeName);
-		static TypeId getTypeId(const std::string & id, const std::string_view className);
+		static void registerClass(const std::string_view className, const std::optional<std::string_view> typeName,
+				const ClassRefBase *, const std::type_info &);
+		static void unregisterClass(const std::string_view className);
+		// The exchange type name of an instance of type, unless it's that of className; id is only called for types
+		// not yet seen, which aren't registered themselves but stand in for one that is
+		static TypeId getTypeId(
+				const std::type_info & type, const function_ref<std::string()> & id, const std::string_view className);
 
+		// Both return either their argument or a name owned by the class registry, which is never released
 		static const std::string & ToExchangeTypeName(const std::string &);
 		static std::string_view ToModelTypeName(const std::string &);
 		[[noreturn]] static void throwIncorrectType(const std::string & name, const std::type_info & target);
@@ -186,6 +200,52 @@ namespace Slicer {
 		static const Hooks<T> & hooks();
 	};
 
+	// While in scope, class instances created by deserializers on this thread are allocated from resource, which
+	// must outlive them; a document built this way can be released in bulk along with the resource.
+	class DLL_PUBLIC ClassAllocation {
+	public:
+		explicit ClassAllocation(std::pmr::memory_resource * resource);
+		~ClassAllocation();
+
+		SPECIAL_MEMBERS_DELETE(ClassAllocation);
+
+		// The resource in scope on this thread, null for the default heap
+		[[nodiscard]] static std::pmr::memory_resource * current();
+
+		template<typename T>
+		[[nodiscard]] static std::shared_ptr<T>
+		make()
+		{
+			if (const auto resource = current()) {
+				return std::allocate_shared<T>(std::pmr::polymorphic_allocator<T> {resource});
+			}
+			return std::make_shared<T>();
+		}
+
+	private:
+		std::pmr::memory_resource * const previous;
+	};
+
+	// Shares the resource in scope on this thread, if any, with others, such as the workers of a parallel
+	// deserializer. Each gets an arena of its own, refilled from the resource under a lock, so the resource needn't
+	// be thread safe and the workers rarely contend. Arenas are allocated from the resource too and never destroyed,
+	// so what they hold is only reclaimed along with the resource, as a document built in bulk would be.
+	class DLL_PUBLIC SharedClassAllocation : private std::pmr::memory_resource {
+	public:
+		SharedClassAllocation();
+
+		// An arena for one thread to put in scope, null for the heap when no resource is
+		[[nodiscard]] std::pmr::memory_resource * arena();
+
+	private:
+		void * do_allocate(std::size_t bytes, std::size_t alignment) override;
+		void do_deallocate(void * p, std::size_t bytes, std::size_t alignment) override;
+		[[nodiscard]] bool do_is_equal(const std::pmr::memory_resource & other) const noexcept override;
+
+		std::pmr::memory_resource * const resource;
+		std::mutex lock;
+	};
+
 	template<typename T>
 	class ModelPartForClass : public ModelPartForComplex<T>, protected ModelPartModel<std::shared_ptr<T>> {
 	public:
@@ -238,6 +298,8 @@ namespace Slicer {
 	public:
 		[[nodiscard]] bool HasValue() const override;
 		[[nodiscard]] ModelPartType GetType() const override;
+		// Names of the possible values of the enumeration
+		[[nodiscard]] virtual std::span<const std::string * const> GetEnumerations() const = 0;
 		static const ModelPartType type;
 	};
 	template<typename T> class EnumMap;
@@ -254,6 +316,8 @@ namespace Slicer {
 
 		bool GetValue(ValueTarget && s) override;
 
+		[[nodiscard]] std::span<const std::string * const> GetEnumerations() const override;
+
 		static const Metadata metadata;
 		static constexpr const EnumMap<T> & enumerations();
 		DLL_PUBLIC static const std::string & lookup(T);
@@ -281,6 +345,8 @@ namespace Slicer {
 
 		bool OnAnonChild(const SubPartHandler &, const HookFilter &) override;
 
+		void SizeHint(std::size_t) override;
+
 		[[nodiscard]] const std::string & GetElementName() const override;
 
 		[[nodiscard]] const Metadata & GetMetadata() const override;
@@ -327,6 +393,8 @@ namespace Slicer {
 		bool OnChild(const SubPartHandler &, std::string_view name, const HookFilter &,
 				MatchCase matchCase = MatchCase::Yes) override;
 
+		void SizeHint(std::size_t) override;
+
 		[[nodiscard]] const Metadata & GetMetadata() const override;
 
 		void OnContained(const ModelPartHandler &) override;
@@ -379,6 +447,118 @@ namespace Slicer {
 	public:
 		using ModelPartForStreamRootBase::ModelPartForStreamRootBase;
 
-		[[nodiscard]] const std::string & GetRootName() const override;
+		[[nodiscard]] const std::string &
+		GetRootName() const override
+		{
+			return ModelPartForRoot<std::vector<T>>::rootName;
+		}
+	};
+
+	// The input side of Stream<T>; a top level sequence deserialized into this passes each element to the
+	// consumer as soon as it is complete, then discards it, so the sequence itself is never built.
+	template<typename T> class ModelPartForConsumer : public ModelPartForSequenceBase {
+	public:
+		using Consumer = function_ref<void(T &&)>;
+
+		explicit ModelPartForConsumer(Consumer c) : consumer(c)
+		{
+			ModelPart::CreateFor<std::vector<T>>(nullptr, [this](auto && seq) {
+				metadata = &seq->GetMetadata();
+			});
+		}
+
+		bool
+		OnAnonChild(const SubPartHandler & h, const HookFilter &) override
+		{
+			T element {};
+			ModelPart::CreateFor(&element, [&h](auto && mp) {
+				h(mp, emptyMetadata);
+			});
+			consumer(std::move(element));
+			return true;
+		}
+
+		[[nodiscard]] const std::string &
+		GetElementName() const override
+		{
+			return ModelPartForSequence<std::vector<T>>::elementName;
+		}
+
+		[[nodiscard]] const Metadata &
+		GetMetadata() const override
+		{
+			return *metadata;
+		}
+
+		void
+		OnContained(const ModelPartHandler & h) override
+		{
+			ModelPart::CreateFor<T>(nullptr, h);
+		}
+
+	private:
+		Consumer consumer;
+		const Metadata * metadata {};
+	};
+
+	// A run of a sequence's elements, presented as a sequence in its own right; lets a serializer write the
+	// elements of each chunk independently for SerializeParallel. For a non-const T, the run is of existing
+	// slots which a deserializer fills in turn for DeserializeParallel.
+	template<typename T> class ModelPartForSequenceChunk : public ModelPartForSequenceBase {
+	public:
+		using Sequence = std::remove_const_t<T>;
+		using Iterator = decltype(std::declval<T &>().begin());
+
+		ModelPartForSequenceChunk(Iterator b, Iterator e) : begin(b), end(e) { }
+
+		void
+		OnEachChild(const ChildHandler & ch) override
+		{
+			for (auto element = begin; element != end; ++element) {
+				ModelPart::CreateFor(&*element, [&ch](auto && mp) {
+					ch(ModelPartForSequence<Sequence>::elementName, mp, nullptr);
+				});
+			}
+		}
+
+		bool
+		OnAnonChild(const SubPartHandler & h, const HookFilter &) override
+		{
+			if constexpr (std::is_const_v<T>) {
+				return false;
+			}
+			else {
+				if (next == end) {
+					return false;
+				}
+				ModelPart::CreateFor(&*next++, [&h](auto && mp) {
+					h(mp, emptyMetadata);
+				});
+				return true;
+			}
+		}
+
+		[[nodiscard]] const std::string &
+		GetElementName() const override
+		{
+			return ModelPartForSequence<Sequence>::elementName;
+		}
+
+		[[nodiscard]] const Metadata &
+		GetMetadata() const override
+		{
+			return ModelPartForSequence<Sequence>::metadata;
+		}
+
+		void
+		OnContained(const ModelPartHandler & h) override
+		{
+			ModelPart::CreateFor<typename Sequence::value_type>(nullptr, h);
+		}
+
+	private:
+		const Iterator begin;
+		const Iterator end;
+		Iterator next {begin};
 	};
 }
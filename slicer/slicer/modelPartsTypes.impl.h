@@ -18,10 +18,13 @@
 #include <boost/assert.hpp>
 #include <boost/preprocessor/comparison/less_equal.hpp>
 #include <boost/preprocessor/if.hpp>
+#include <algorithm>
 #include <c++11Helpers.h>
 #include <cstddef>
+#include <iterator>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <string_view>
 #include <type_traits>
@@ -195,11 +198,58 @@ namespace Slicer {
 		return !!*this->Model;
 	}
 
+	template<typename ET>
+	inline const TValueSource<ET> *
+	ModelPartForConvertedBase::exchangeSource(const ValueSource & vsp)
+	{
+		if constexpr (std::is_base_of_v<TValueSource<ET>, ValueSource>) {
+			return &vsp;
+		}
+		else {
+			if constexpr (exchangeTypeOf<ET> != ExchangeType::None) {
+				if (auto exchanged = static_cast<const TValueSource<ET> *>(vsp.exchange(exchangeTypeOf<ET>))) {
+					return exchanged;
+				}
+			}
+			// Also finds implementations which don't override exchange(), at the cost of both the call above and a
+			// dynamic_cast for every value; tagging them with exchange() avoids it
+			return dynamic_cast<const TValueSource<ET> *>(&vsp);
+		}
+	}
+
+	template<typename ET>
+	inline const TValueTarget<ET> *
+	ModelPartForConvertedBase::exchangeTarget(const ValueTarget & vtp)
+	{
+		if constexpr (std::is_base_of_v<TValueTarget<ET>, ValueTarget>) {
+			return &vtp;
+		}
+		else {
+			if constexpr (exchangeTypeOf<ET> != ExchangeType::None) {
+				if (auto exchanged = static_cast<const TValueTarget<ET> *>(vtp.exchange(exchangeTypeOf<ET>))) {
+					return exchanged;
+				}
+			}
+			// As exchangeSource
+			return dynamic_cast<const TValueTarget<ET> *>(&vtp);
+		}
+	}
+
 	template<typename ET, typename MT, typename Conv>
 	inline bool
 	ModelPartForConvertedBase::tryConvertFrom(const ValueSource & vsp, MT * model, const Conv & conv)
 	{
-		if (auto vspt = dynamic_cast<const TValueSource<ET> *>(&vsp)) {
+		if constexpr (std::is_same_v<ET, std::string_view>) {
+			// Like std::string, always available; in place where the source allows
+			using CA = callable_param<Conv, 0>;
+			setView(vsp, [model, &conv](std::string_view tmp) {
+				if (auto converted = conv(Coerce<CA>()(tmp)); Coerce<MT>::valueExists(converted)) {
+					*model = Coerce<MT>()(std::move(converted));
+				}
+			});
+			return true;
+		}
+		else if (auto vspt = exchangeSource<ET>(vsp)) {
 			using CA = callable_param<Conv, 0>;
 			ET tmp;
 			vspt->set(tmp);
@@ -215,7 +265,7 @@ namespace Slicer {
 	inline bool
 	ModelPartForConvertedBase::tryConvertFrom(const ValueSource & vsp, MT * model)
 	{
-		if (auto vspt = dynamic_cast<const TValueSource<ET> *>(&vsp)) {
+		if (auto vspt = exchangeSource<ET>(vsp)) {
 			if (Coerce<ET>::valueExists(*model)) {
 				vspt->set(Coerce<ET>()(*model));
 			}
@@ -228,7 +278,17 @@ namespace Slicer {
 	inline TryConvertResult
 	ModelPartForConvertedBase::tryConvertTo(const ValueTarget & vsp, const MT * model, const Conv & conv)
 	{
-		if (auto vspt = dynamic_cast<const TValueTarget<ET> *>(&vsp)) {
+		if constexpr (std::is_same_v<ET, std::string_view>) {
+			using CA = callable_param<Conv, 0>;
+			if (Coerce<std::decay_t<CA>>::valueExists(*model)) {
+				if (auto converted = conv(Coerce<CA>()(*model)); Coerce<ET>::valueExists(converted)) {
+					getView(vsp, Coerce<ET>()(std::move(converted)));
+					return TryConvertResult::Value;
+				}
+			}
+			return TryConvertResult::NoValue;
+		}
+		else if (auto vspt = exchangeTarget<ET>(vsp)) {
 			using CA = callable_param<Conv, 0>;
 			if (Coerce<std::decay_t<CA>>::valueExists(*model)) {
 				if (auto converted = conv(Coerce<CA>()(*model)); Coerce<ET>::valueExists(converted)) {
@@ -245,7 +305,7 @@ namespace Slicer {
 	inline TryConvertResult
 	ModelPartForConvertedBase::tryConvertTo(const ValueTarget & vsp, const MT * model)
 	{
-		if (auto vspt = dynamic_cast<const TValueTarget<ET> *>(&vsp)) {
+		if (auto vspt = exchangeTarget<ET>(vsp)) {
 			if (Coerce<ET>::valueExists(*model)) {
 				vspt->get(Coerce<ET>()(*model));
 				return TryConvertResult::Value;
@@ -404,7 +464,7 @@ namespace Slicer {
 			ModelPartForComplexBase::throwAbstractClassException(typeid(T));
 		}
 		else {
-			*this->Model = std::make_shared<T>();
+			*this->Model = ClassAllocation::make<T>();
 		}
 	}
 
@@ -448,7 +508,7 @@ namespace Slicer {
 	void
 	ModelPartForClass<T>::registerClass()
 	{
-		ModelPartForComplexBase::registerClass(className, typeName, classref);
+		ModelPartForComplexBase::registerClass(className, typeName, classref, typeid(T));
 	}
 
 	template<typename Inst, typename T> struct ClassRefImpl : public ClassRef<T> {
@@ -482,7 +542,7 @@ namespace Slicer {
 	void
 	ModelPartForClass<T>::unregisterClass()
 	{
-		ModelPartForComplexBase::unregisterClass(className, typeName);
+		ModelPartForComplexBase::unregisterClass(className);
 	}
 
 	template<typename T>
@@ -490,15 +550,20 @@ namespace Slicer {
 	ModelPartForClass<T>::GetTypeId() const
 	{
 		BOOST_ASSERT(this->Model);
+		const auto & type = typeid(**this->Model);
+		if (type == typeid(T)) {
+			return {};
+		}
 		return ModelPartForComplexBase::getTypeId(
-				[this]() {
+				type,
+				[this]() -> std::string {
 					if constexpr (requires { (*this->Model)->ice_id(); }) {
 						return (*this->Model)->ice_id();
 					}
 					else {
 						return ModelPartForComplexBase::demangle(typeid(*this->Model->get()).name());
 					}
-				}(),
+				},
 				className);
 	}
 
@@ -554,9 +619,9 @@ namespace Slicer {
 	ModelPartForEnum<T>::SetValue(ValueSource && s)
 	{
 		BOOST_ASSERT(this->Model);
-		std::string val;
-		s.set(val);
-		*this->Model = lookup(val);
+		setView(s, [this](std::string_view val) {
+			*this->Model = lookup(val);
+		});
 	}
 
 	template<typename T>
@@ -568,6 +633,22 @@ namespace Slicer {
 		return true;
 	}
 
+	template<typename T>
+	std::span<const std::string * const>
+	ModelPartForEnum<T>::GetEnumerations() const
+	{
+		static const auto names = [] {
+			const auto nodes = enumerations().nodes();
+			std::vector<const std::string *> n;
+			n.reserve(nodes.size());
+			std::transform(nodes.begin(), nodes.end(), std::back_inserter(n), [](const auto & node) {
+				return node.nameStr;
+			});
+			return n;
+		}();
+		return names;
+	}
+
 	// ModelPartForSequence
 	template<typename T>
 	void
@@ -592,6 +673,16 @@ namespace Slicer {
 		return true;
 	}
 
+	template<typename T>
+	void
+	ModelPartForSequence<T>::SizeHint(std::size_t size)
+	{
+		BOOST_ASSERT(this->Model);
+		if constexpr (requires { this->Model->reserve(size); }) {
+			this->Model->reserve(this->Model->size() + size);
+		}
+	}
+
 	template<typename T>
 	const Metadata &
 	ModelPartForSequence<T>::GetMetadata() const
@@ -624,7 +715,9 @@ namespace Slicer {
 	void
 	ModelPartForDictionaryElementInserter<T>::Complete()
 	{
-		dictionary->insert(value);
+		// Constant time for input already in key order, one extra comparison otherwise. The key is const so
+		// still copied, but the mapped value is moved; value isn't used again.
+		dictionary->insert(dictionary->end(), std::move(value));
 	}
 
 	// ModelPartForDictionary
@@ -660,6 +753,16 @@ namespace Slicer {
 		return true;
 	}
 
+	template<typename T>
+	void
+	ModelPartForDictionary<T>::SizeHint(std::size_t size)
+	{
+		BOOST_ASSERT(this->Model);
+		if constexpr (requires { this->Model->reserve(size); }) {
+			this->Model->reserve(this->Model->size() + size);
+		}
+	}
+
 	template<typename T>
 	const Metadata &
 	ModelPartForDictionary<T>::GetMetadata() const
@@ -693,13 +796,6 @@ namespace Slicer {
 			});
 		});
 	}
-
-	template<typename T>
-	const std::string &
-	ModelPartForStreamRoot<T>::GetRootName() const
-	{
-		return ModelPartForRoot<std::vector<T>>::rootName;
-	}
 }
 #ifdef __clang__
 #	pragma clang diagnostic pop
@@ -0,0 +1,139 @@
+#pragma once
+
+#include "function_ref.h"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace Slicer {
+	// Chunks per thread; a few more than one evens out elements of differing size
+	constexpr unsigned int PARALLEL_CHUNKS_PER_THREAD {4};
+
+	// The number of threads used when 0 is requested
+	[[nodiscard]] inline unsigned int
+	defaultParallelism()
+	{
+		return std::max(1U, std::thread::hardware_concurrency());
+	}
+
+	// The number of chunks count elements are split into for threads threads
+	[[nodiscard]] inline std::size_t
+	parallelChunks(std::size_t count, unsigned int threads)
+	{
+		return std::min<std::size_t>(count, std::size_t {threads} * PARALLEL_CHUNKS_PER_THREAD);
+	}
+
+	// Hands each serialized chunk of a sequence's elements, in order, to the function it's given
+	using ChunkSource = function_ref<void(const function_ref<void(std::string &&)> &)>;
+
+	// Splits [begin, end) into chunks and calls writeChunk(chunkBegin, chunkEnd) for each on a pool of threads,
+	// passing the buffers it returns to emit on the calling thread, in order, as they become available.
+	template<std::random_access_iterator It, typename WriteChunk, typename Emit>
+	void
+	writeChunksParallel(It begin, It end, unsigned int threads, const WriteChunk & writeChunk, const Emit & emit)
+	{
+		using Buffer = std::invoke_result_t<const WriteChunk &, It, It>;
+		const auto count = static_cast<std::size_t>(std::distance(begin, end));
+		if (!threads) {
+			threads = defaultParallelism();
+		}
+		const auto chunks = parallelChunks(count, threads);
+		const auto chunkBegin = [begin, count, chunks](std::size_t chunk) {
+			return begin + static_cast<std::iter_difference_t<It>>(count * chunk / chunks);
+		};
+		if (threads == 1) {
+			for (std::size_t chunk {}; chunk < chunks; chunk++) {
+				emit(writeChunk(chunkBegin(chunk), chunkBegin(chunk + 1)));
+			}
+			return;
+		}
+
+		std::vector<std::promise<Buffer>> buffers(chunks);
+		std::atomic<std::size_t> next {};
+		const auto worker = [&]() {
+			for (auto chunk = next++; chunk < chunks; chunk = next++) {
+				try {
+					buffers[chunk].set_value(writeChunk(chunkBegin(chunk), chunkBegin(chunk + 1)));
+				}
+				catch (...) {
+					buffers[chunk].set_exception(std::current_exception());
+				}
+			}
+		};
+		std::vector<std::jthread> pool;
+		const auto poolSize = std::min<std::size_t>(threads, chunks);
+		pool.reserve(poolSize);
+		while (pool.size() < poolSize) {
+			pool.emplace_back(worker);
+		}
+		try {
+			for (auto & buffer : buffers) {
+				emit(buffer.get_future().get());
+			}
+		}
+		catch (...) {
+			// Abandon the chunks not yet started; the pool is joined on the way out
+			next = chunks;
+			throw;
+		}
+	}
+
+	// Splits the indexes [0, count) into chunks and calls readChunk(chunkBegin, chunkEnd) for each on a pool of
+	// threads. Once all have finished, rethrows the exception of the first chunk that failed, if any; chunks not
+	// yet started when one fails are abandoned.
+	template<typename ReadChunk>
+	void
+	readChunksParallel(std::size_t count, unsigned int threads, const ReadChunk & readChunk)
+	{
+		if (!threads) {
+			threads = defaultParallelism();
+		}
+		const auto chunks = parallelChunks(count, threads);
+		const auto chunkBegin = [count, chunks](std::size_t chunk) {
+			return count * chunk / chunks;
+		};
+		if (threads == 1) {
+			for (std::size_t chunk {}; chunk < chunks; chunk++) {
+				readChunk(chunkBegin(chunk), chunkBegin(chunk + 1));
+			}
+			return;
+		}
+
+		std::vector<std::exception_ptr> errors(chunks);
+		std::atomic<std::size_t> next {};
+		{
+			const auto worker = [&]() {
+				for (auto chunk = next++; chunk < chunks; chunk = next++) {
+					try {
+						readChunk(chunkBegin(chunk), chunkBegin(chunk + 1));
+					}
+					catch (...) {
+						errors[chunk] = std::current_exception();
+						next = chunks;
+					}
+				}
+			};
+			std::vector<std::jthread> pool;
+			const auto poolSize = std::min<std::size_t>(threads, chunks);
+			pool.reserve(poolSize);
+			while (pool.size() < poolSize) {
+				pool.emplace_back(worker);
+			}
+		}
+		if (const auto error = std::find_if(errors.begin(), errors.end(),
+					[](const auto & e) {
+						return static_cast<bool>(e);
+					});
+				error != errors.end()) {
+			std::rethrow_exception(*error);
+		}
+	}
+}
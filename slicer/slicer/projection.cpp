@@ -0,0 +1,225 @@
+#include "projection.h"
+#include <utility>
+
+namespace Slicer {
+	Projection::Projection(std::initializer_list<std::string_view> paths) : all {false}
+	{
+		for (const auto path : paths) {
+			add(path);
+		}
+	}
+
+	void
+	Projection::add(std::string_view path)
+	{
+		if (all) {
+			return;
+		}
+		const auto dot = path.find('.');
+		const auto leaf = (dot == std::string_view::npos);
+		const auto head = path.substr(0, dot);
+		auto member = members.find(head);
+		if (member == members.end()) {
+			member = members.emplace(head, Projection {leaf}).first;
+		}
+		else if (leaf) {
+			member->second = Projection {};
+		}
+		if (!leaf) {
+			member->second.add(path.substr(dot + 1));
+		}
+	}
+
+	const Projection *
+	Projection::find(const HookCommon * hook) const
+	{
+		if (all) {
+			return this;
+		}
+		if (auto member = members.find(hook->name); member != members.end()) {
+			return &member->second;
+		}
+		return nullptr;
+	}
+
+	ModelPartForProjection::ModelPartForProjection(ModelPartParam m, const Projection & p, bool de) :
+		mp(m), projection(p), dictionaryElement(de)
+	{
+	}
+
+	bool
+	ModelPartForProjection::filtering() const
+	{
+		return !dictionaryElement && mp->GetType() == ModelPartType::Complex;
+	}
+
+	void
+	ModelPartForProjection::wrap(ModelPartParam cmp, const Projection & p, bool de, const ModelPartHandler & h)
+	{
+		if (p.selectsAll()) {
+			return h(cmp);
+		}
+		ModelPartForProjection projected {cmp, p, de};
+		h(&projected);
+	}
+
+	void
+	ModelPartForProjection::OnEachChild(const ChildHandler & ch)
+	{
+		const auto childrenOfDictionary = (mp->GetType() == ModelPartType::Dictionary);
+		mp->OnEachChild([this, &ch, childrenOfDictionary](const std::string & name, auto && cmp, auto && hook) {
+			const auto selected = (hook && filtering()) ? projection.find(hook) : &projection;
+			if (selected) {
+				wrap(cmp, *selected, childrenOfDictionary, [&ch, &name, hook](auto && pmp) {
+					ch(name, pmp, hook);
+				});
+			}
+		});
+	}
+
+	bool
+	ModelPartForProjection::OnAnonChild(const SubPartHandler & h, const HookFilter & flt)
+	{
+		const auto childrenOfDictionary = (mp->GetType() == ModelPartType::Dictionary);
+		const Projection * selected {&projection};
+		return mp->OnAnonChild(
+				[&h, &selected, childrenOfDictionary](auto && cmp, auto && md) {
+					wrap(cmp, *selected, childrenOfDictionary, [&h, &md](auto && pmp) {
+						h(pmp, md);
+					});
+				},
+				[this, &flt, &selected](auto && hook) {
+					return hook->filter(flt) && (!filtering() || (selected = projection.find(hook)));
+				});
+	}
+
+	bool
+	ModelPartForProjection::OnChild(
+			const SubPartHandler & h, std::string_view name, const HookFilter & flt, MatchCase matchCase)
+	{
+		const Projection * selected {&projection};
+		return mp->OnChild(
+				[&h, &selected](auto && cmp, auto && md) {
+					wrap(cmp, *selected, false, [&h, &md](auto && pmp) {
+						h(pmp, md);
+					});
+				},
+				name,
+				[this, &flt, &selected](auto && hook) {
+					return hook->filter(flt) && (!filtering() || (selected = projection.find(hook)));
+				},
+				matchCase);
+	}
+
+	void
+	ModelPartForProjection::OnSubclass(const ModelPartHandler & h, const std::string & name)
+	{
+		mp->OnSubclass(
+				[this, &h](auto && smp) {
+					ModelPartForProjection projected {smp, projection, dictionaryElement};
+					h(&projected);
+				},
+				name);
+	}
+
+	TypeId
+	ModelPartForProjection::GetTypeId() const
+	{
+		return mp->GetTypeId();
+	}
+
+	std::optional<std::string>
+	ModelPartForProjection::GetTypeIdProperty() const
+	{
+		return mp->GetTypeIdProperty();
+	}
+
+	ModelPartType
+	ModelPartForProjection::GetType() const
+	{
+		return mp->GetType();
+	}
+
+	void
+	ModelPartForProjection::Create()
+	{
+		mp->Create();
+	}
+
+	void
+	ModelPartForProjection::Complete()
+	{
+		mp->Complete();
+	}
+
+	void
+	ModelPartForProjection::SizeHint(std::size_t size)
+	{
+		mp->SizeHint(size);
+	}
+
+	void
+	ModelPartForProjection::SetValue(ValueSource && s)
+	{
+		mp->SetValue(std::move(s));
+	}
+
+	bool
+	ModelPartForProjection::GetValue(ValueTarget && t)
+	{
+		return mp->GetValue(std::move(t));
+	}
+
+	bool
+	ModelPartForProjection::HasValue() const
+	{
+		return mp->HasValue();
+	}
+
+	const Metadata &
+	ModelPartForProjection::GetMetadata() const
+	{
+		return mp->GetMetadata();
+	}
+
+	bool
+	ModelPartForProjection::IsOptional() const
+	{
+		return mp->IsOptional();
+	}
+
+	void
+	ModelPartForProjection::OnContained(const ModelPartHandler & h)
+	{
+		mp->OnContained(h);
+	}
+
+	ModelPartForProjectionRoot::ModelPartForProjectionRoot(ModelPartForRootParam r, ModelPartForProjection & p) :
+		ModelPartForRootBase(&p), root(r)
+	{
+	}
+
+	const std::string &
+	ModelPartForProjectionRoot::GetRootName() const
+	{
+		return root->GetRootName();
+	}
+
+	bool
+	ModelPartForProjectionRoot::HasValue() const
+	{
+		return root->HasValue();
+	}
+
+	void
+	ModelPartForProjectionRoot::Write(::Ice::OutputStream & s) const
+	{
+		root->Write(s);
+	}
+
+	void
+	ModelPartForProjectionRoot::Read(::Ice::InputStream & s)
+	{
+		root->Read(s);
+	}
+}
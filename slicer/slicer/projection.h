@@ -0,0 +1,87 @@
+#pragma once
+
+#include "modelParts.h"
+#include <functional>
+#include <initializer_list>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <visibility.h>
+
+namespace Slicer {
+	// A selection of members to deserialize, as dot separated paths of member (hook) names. Sequence and
+	// dictionary levels don't appear in paths; their elements take the projection of the collection itself.
+	// A path selects the whole subtree of its last member.
+	class DLL_PUBLIC Projection {
+	public:
+		// Selects everything
+		Projection() = default;
+		Projection(std::initializer_list<std::string_view> paths);
+
+		void add(std::string_view path);
+
+		[[nodiscard]] inline bool
+		selectsAll() const noexcept
+		{
+			return all;
+		}
+
+		// The projection of a member, nullptr if not selected
+		[[nodiscard]] const Projection * find(const HookCommon *) const;
+
+	private:
+		explicit Projection(bool a) : all {a} { }
+
+		bool all {true};
+		std::map<std::string, Projection, std::less<>> members;
+	};
+
+	// Applies a projection to the model part it wraps. Unselected members are filtered out through the
+	// HookFilter of OnChild/OnAnonChild, so their model parts are never created and deserializers skip
+	// their input; everything else passes straight through.
+	class DLL_PUBLIC ModelPartForProjection : public ModelPart {
+	public:
+		ModelPartForProjection(ModelPartParam mp, const Projection & projection, bool dictionaryElement = false);
+
+		void OnEachChild(const ChildHandler &) override;
+		bool OnAnonChild(const SubPartHandler &, const HookFilter &) override;
+		bool OnChild(const SubPartHandler &, std::string_view memberName, const HookFilter &,
+				MatchCase matchCase = MatchCase::Yes) override;
+		void OnSubclass(const ModelPartHandler &, const std::string &) override;
+		[[nodiscard]] TypeId GetTypeId() const override;
+		[[nodiscard]] std::optional<std::string> GetTypeIdProperty() const override;
+		[[nodiscard]] ModelPartType GetType() const override;
+		void Create() override;
+		void Complete() override;
+		void SizeHint(std::size_t) override;
+		void SetValue(ValueSource &&) override;
+		bool GetValue(ValueTarget &&) override;
+		[[nodiscard]] bool HasValue() const override;
+		[[nodiscard]] const Metadata & GetMetadata() const override;
+		[[nodiscard]] bool IsOptional() const override;
+		void OnContained(const ModelPartHandler &) override;
+
+	private:
+		[[nodiscard]] bool filtering() const;
+		static void wrap(ModelPartParam, const Projection &, bool dictionaryElement, const ModelPartHandler &);
+
+		ModelPartParam mp;
+		const Projection & projection;
+		// The key/value pair of a dictionary, its members aren't subject to the projection
+		const bool dictionaryElement;
+	};
+
+	class DLL_PUBLIC ModelPartForProjectionRoot : public ModelPartForRootBase {
+	public:
+		ModelPartForProjectionRoot(ModelPartForRootParam root, ModelPartForProjection & projected);
+
+		[[nodiscard]] const std::string & GetRootName() const override;
+		[[nodiscard]] bool HasValue() const override;
+		void Write(::Ice::OutputStream &) const override;
+		void Read(::Ice::InputStream &) override;
+
+	private:
+		ModelPartForRootParam root;
+	};
+}
@@ -1,7 +1,11 @@
 #pragma once
 
+#include <memory_resource>
 #include <slicer/modelParts.h>
+#include <slicer/modelPartsTypes.h>
+#include <slicer/projection.h>
 #include <slicer/serializer.h>
+#include <utility>
 
 namespace Slicer {
 	template<typename Object>
@@ -22,6 +26,72 @@ namespace Slicer {
 		return DeserializeAnyWith<Object>(Deserializer(std::forward<SerializerParams>(sp)...));
 	}
 
+	// Deserializes only the members selected by projection; everything else is skipped and left default
+	template<typename Object>
+	[[nodiscard]] Object
+	DeserializeAnyWith(any_ptr<Deserializer> deserializer, const Projection & projection)
+	{
+		Object object {};
+		ModelPart::OnRootFor<Object>(object, [deserializer, &projection](auto && root) {
+			ModelPartForProjection projected {root->mp, projection};
+			deserializer->Deserialize(ModelPartForProjectionRoot {root, projected});
+		});
+		return object;
+	}
+
+	template<typename Deserializer, typename Object, typename... SerializerParams>
+	[[nodiscard]] Object
+	DeserializeProjected(const Projection & projection, SerializerParams &&... sp)
+	{
+		return DeserializeAnyWith<Object>(Deserializer(std::forward<SerializerParams>(sp)...), projection);
+	}
+
+	// Deserializes with the class instances allocated from resource, which must outlive them; it's only used by
+	// one thread at a time, so needn't be thread safe
+	template<typename Object>
+	[[nodiscard]] Object
+	DeserializeAnyWith(any_ptr<Deserializer> deserializer, std::pmr::memory_resource * resource)
+	{
+		const ClassAllocation allocation {resource};
+		return DeserializeAnyWith<Object>(deserializer);
+	}
+
+	template<typename Deserializer, typename Object, typename... SerializerParams>
+	[[nodiscard]] Object
+	DeserializeAllocated(std::pmr::memory_resource * resource, SerializerParams &&... sp)
+	{
+		return DeserializeAnyWith<Object>(Deserializer(std::forward<SerializerParams>(sp)...), resource);
+	}
+
+	// Deserializes a top level sequence one element at a time, handing each to consumer once complete
+	template<typename Element>
+	void
+	DeserializeEachWith(
+			const typename ModelPartForConsumer<Element>::Consumer & consumer, any_ptr<Deserializer> deserializer)
+	{
+		ModelPartForConsumer<Element> sequence {consumer};
+		deserializer->Deserialize(ModelPartForStreamRoot<Element> {sequence});
+	}
+
+	template<typename Deserializer, typename Element, typename... SerializerParams>
+	void
+	DeserializeEach(const typename ModelPartForConsumer<Element>::Consumer & consumer, SerializerParams &&... sp)
+	{
+		DeserializeEachWith<Element>(consumer, Deserializer(std::forward<SerializerParams>(sp)...));
+	}
+
+	// Deserializes a top level sequence with chunks of its elements read concurrently on up to threads threads
+	// (0 for one per core); the result is the same as DeserializeAny's. Deserializer must provide
+	// DeserializeParallel.
+	template<typename Deserializer, typename Seq, typename... SerializerParams>
+	[[nodiscard]] Seq
+	DeserializeParallel(unsigned int threads, SerializerParams &&... sp)
+	{
+		Seq seq;
+		Deserializer(std::forward<SerializerParams>(sp)...).DeserializeParallel(seq, threads);
+		return seq;
+	}
+
 	template<typename Object>
 	void
 	SerializeAnyWith(const Object & object, any_ptr<Serializer> serializer)
@@ -37,4 +107,13 @@ namespace Slicer {
 	{
 		SerializeAnyWith(object, Serializer(std::forward<SerializerParams>(sp)...));
 	}
+
+	// Serializes a top level sequence with chunks of its elements written concurrently on up to threads threads
+	// (0 for one per core); the output is the same as SerializeAny's. Serializer must provide SerializeParallel.
+	template<typename Serializer, typename Seq, typename... SerializerParams>
+	void
+	SerializeParallel(const Seq & seq, unsigned int threads, SerializerParams &&... sp)
+	{
+		Serializer(std::forward<SerializerParams>(sp)...).SerializeParallel(seq, threads);
+	}
 }
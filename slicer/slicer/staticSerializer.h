@@ -0,0 +1,118 @@
+#pragma once
+
+#include "modelParts.h"
+#include "modelPartsTypes.h"
+#include <Ice/Config.h>
+#include <Ice/Optional.h>
+#include <c++11Helpers.h>
+#include <memory>
+#include <string>
+#include <utility>
+#include <visibility.h>
+
+namespace Slicer {
+	// Format specific output driven by StaticWalker. Values are only ever written once known to exist, so a
+	// writer needn't defer anything; fallback/fallbackMember hand a sub-tree to the format's ModelPart path.
+	class DLL_PUBLIC StaticWriter {
+	public:
+		StaticWriter() = default;
+		virtual ~StaticWriter() = default;
+		SPECIAL_MEMBERS_DEFAULT(StaticWriter);
+
+		virtual void beginRoot(const std::string & name) = 0;
+		virtual void endRoot() = 0;
+		virtual void null() = 0;
+
+		virtual void beginObject() = 0;
+		virtual void endObject() = 0;
+		virtual void beginMember(const std::string & name) = 0;
+		virtual void endMember() = 0;
+
+		virtual void beginArray() = 0;
+		virtual void endArray() = 0;
+		virtual void beginElement(const std::string & name) = 0;
+		virtual void endElement() = 0;
+
+		virtual void value(bool) = 0;
+		virtual void value(Ice::Byte) = 0;
+		virtual void value(Ice::Short) = 0;
+		virtual void value(Ice::Int) = 0;
+		virtual void value(Ice::Long) = 0;
+		virtual void value(Ice::Float) = 0;
+		virtual void value(Ice::Double) = 0;
+		virtual void value(const std::string &) = 0;
+
+		// Write mp in place of the value at the current position
+		virtual void fallback(ModelPartParam mp) = 0;
+		// Write mp as member name (or not at all if it has no value)
+		virtual void fallbackMember(const std::string & name, ModelPartParam mp) = 0;
+	};
+
+	// Walks a T directly, calling the writer for each node. Specialisations for Slice types are generated by
+	// `slicer --static`; those types must be generated that way for SerializeStatic to link.
+	template<typename T> struct StaticWalker {
+		static void walk(StaticWriter &, const T &);
+	};
+
+	template<typename T> struct StaticWalkerSimple {
+		static inline void
+		walk(StaticWriter & w, const T & v)
+		{
+			w.value(v);
+		}
+	};
+
+	template<> struct StaticWalker<bool> : StaticWalkerSimple<bool> { };
+	template<> struct StaticWalker<Ice::Byte> : StaticWalkerSimple<Ice::Byte> { };
+	template<> struct StaticWalker<Ice::Short> : StaticWalkerSimple<Ice::Short> { };
+	template<> struct StaticWalker<Ice::Int> : StaticWalkerSimple<Ice::Int> { };
+	template<> struct StaticWalker<Ice::Long> : StaticWalkerSimple<Ice::Long> { };
+	template<> struct StaticWalker<Ice::Float> : StaticWalkerSimple<Ice::Float> { };
+	template<> struct StaticWalker<Ice::Double> : StaticWalkerSimple<Ice::Double> { };
+	template<> struct StaticWalker<std::string> : StaticWalkerSimple<std::string> { };
+
+	template<typename T> struct StaticWalker<Ice::optional<T>> {
+		static inline void
+		walk(StaticWriter & w, const Ice::optional<T> & v)
+		{
+			StaticWalker<T>::walk(w, *v);
+		}
+	};
+
+	// Whether there is anything to write; unset optionals and null class pointers are omitted
+	template<typename T>
+	[[nodiscard]] constexpr inline bool
+	staticHasValue(const T &)
+	{
+		return true;
+	}
+
+	template<typename T>
+	[[nodiscard]] inline bool
+	staticHasValue(const std::shared_ptr<T> & v)
+	{
+		return static_cast<bool>(v);
+	}
+
+	template<typename T>
+	[[nodiscard]] inline bool
+	staticHasValue(const Ice::optional<T> & v)
+	{
+		return v && staticHasValue(*v);
+	}
+
+	template<typename Writer, typename Object, typename... WriterParams>
+	void
+	SerializeStatic(const Object & object, WriterParams &&... wp)
+	{
+		Writer writer(std::forward<WriterParams>(wp)...);
+		writer.beginRoot(ModelPartForRoot<Object>::rootName);
+		if (staticHasValue(object)) {
+			StaticWalker<Object>::walk(writer, object);
+		}
+		else {
+			writer.null();
+		}
+		writer.endRoot();
+	}
+}
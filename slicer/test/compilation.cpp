@@ -12,6 +12,7 @@
 #include <Ice/Config.h>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <typeinfo>
 #include <vector>
 
@@ -20,6 +21,8 @@
 BOOST_TEST_DONT_PRINT_LOG_VALUE(std::type_info)
 // cppcheck-suppress unknownMacro
 BOOST_TEST_DONT_PRINT_LOG_VALUE(Slicer::ModelPartType)
+// cppcheck-suppress unknownMacro
+BOOST_TEST_DONT_PRINT_LOG_VALUE(TestModule::SomeNumbers)
 // LCOV_EXCL_STOP
 
 // Nesting BOOST_TEST_CONTEXT causes shadowing
@@ -176,6 +179,86 @@ BOOST_AUTO_TEST_CASE(compile_auto_modelpart_type_enum)
 			{ BOOST_CHECK_THROW(mpp->OnContained(DontCall), std::logic_error); });
 }
 
+namespace {
+	// Text only, and only as a view
+	class ViewOnlySource : public Slicer::ValueSource, public Slicer::TValueSource<std::string_view> {
+	public:
+		explicit ViewOnlySource(std::string_view t) : text(t) { }
+
+		void
+		set(bool &) const override
+		{
+			DontCall();
+		}
+
+		void
+		set(Ice::Byte &) const override
+		{
+			DontCall();
+		}
+
+		void
+		set(Ice::Short &) const override
+		{
+			DontCall();
+		}
+
+		void
+		set(Ice::Int &) const override
+		{
+			DontCall();
+		}
+
+		void
+		set(Ice::Long &) const override
+		{
+			DontCall();
+		}
+
+		void
+		set(Ice::Float &) const override
+		{
+			DontCall();
+		}
+
+		void
+		set(Ice::Double &) const override
+		{
+			DontCall();
+		}
+
+		void
+		set(std::string &) const override
+		{
+			DontCall();
+		}
+
+		void
+		set(std::string_view & v) const override
+		{
+			v = text;
+		}
+
+		[[nodiscard]] const void *
+		exchange(Slicer::ExchangeType t) const override
+		{
+			return Slicer::exchangeFor<Slicer::TValueSource, std::string_view>(this, t);
+		}
+
+	private:
+		std::string_view text;
+	};
+}
+
+BOOST_AUTO_TEST_CASE(enum_set_from_view)
+{
+	TestModule::SomeNumbers number {TestModule::SomeNumbers::One};
+	Slicer::ModelPart::CreateFor(&number, [](auto && mpp) {
+		mpp->SetValue(ViewOnlySource {"FiftyFive"});
+	});
+	BOOST_CHECK_EQUAL(number, TestModule::SomeNumbers::FiftyFive);
+}
+
 BOOST_AUTO_TEST_CASE(normalClassTypeId)
 {
 	TestModule::BasePtr base = std::make_shared<TestModule::Base>(1);
@@ -211,6 +294,19 @@ BOOST_AUTO_TEST_CASE(normalSubSubClassTypeId)
 	});
 }
 
+BOOST_AUTO_TEST_CASE(subClassTypeIdShared)
+{
+	TestModule::BasePtr d1a = std::make_shared<TestModule::D1>(1, 2);
+	TestModule::BasePtr d1b = std::make_shared<TestModule::D1>(3, 4);
+	Slicer::ModelPart::CreateFor(&d1a, [&d1b](auto && a) {
+		Slicer::ModelPart::CreateFor(&d1b, [&a](auto && b) {
+			// Both name the registry's copy; nothing is built per instance
+			BOOST_REQUIRE(a->GetTypeId());
+			BOOST_CHECK_EQUAL(a->GetTypeId(), b->GetTypeId());
+		});
+	});
+}
+
 BOOST_AUTO_TEST_CASE(localClassTypeId)
 {
 	Locals::LocalClassPtr base = std::make_shared<Locals::LocalClass>(1, "One");
@@ -1,25 +1,117 @@
+#include <atomic>
 #include <benchmark/benchmark.h>
+#include <classes.h>
+#include <classtype.h>
+#include <collections.h>
+#include <cstdint>
+#include <cstdlib>
 #include <definedDirs.h>
 #include <enums.h>
 #include <json.h>
 #include <json/serializer.h>
 #include <locals.h>
+#include <memory>
+#include <memory_resource>
+#include <new>
 #include <optionals.h>
 #include <slicer/slicer.h>
+#include <sstream>
+#include <string>
+#include <synthetic.h>
+#include <wide.h>
 #include <xml.h>
 #include <xml/serializer.h>
 // Must go last
 #include <libxml++/parsers/domparser.h>
 
+// Count heap allocations so each benchmark can report allocations per object; atomic for the parallel serializers
+static std::atomic<std::size_t> allocations {};
+
+void *
+operator new(std::size_t n)
+{
+	allocations.fetch_add(1, std::memory_order_relaxed);
+	if (auto p = std::malloc(n ? n : 1)) {
+		return p;
+	}
+	throw std::bad_alloc();
+}
+
+void
+operator delete(void * p) noexcept
+{
+	std::free(p);
+}
+
+void
+operator delete(void * p, std::size_t) noexcept
+{
+	std::free(p);
+}
+
 class CoreFixture : public benchmark::Fixture {
 protected:
 	template<typename Deserializer, typename T, typename... Args>
 	void
 	runDeserialize(benchmark::State & state, Args &&... args)
 	{
+		const std::size_t before = allocations;
 		for (auto _ : state) {
 			benchmark::DoNotOptimize(Slicer::DeserializeAny<Deserializer, T>(std::forward<Args>(args)...));
 		}
+		countAllocations(state, before);
+	}
+
+	template<typename Serializer, typename T>
+	void
+	runSerialize(benchmark::State & state, const T & obj)
+	{
+		std::size_t bytes {};
+		const std::size_t before = allocations;
+		for (auto _ : state) {
+			std::ostringstream out;
+			Slicer::SerializeAny<Serializer>(obj, out);
+			bytes += out.str().length();
+			benchmark::DoNotOptimize(out);
+		}
+		countAllocations(state, before);
+		state.SetBytesProcessed(static_cast<int64_t>(bytes));
+	}
+
+	template<typename Writer, typename T>
+	void
+	runSerializeStatic(benchmark::State & state, const T & obj)
+	{
+		std::size_t bytes {};
+		const std::size_t before = allocations;
+		for (auto _ : state) {
+			std::ostringstream out;
+			Slicer::SerializeStatic<Writer>(obj, out);
+			bytes += out.str().length();
+			benchmark::DoNotOptimize(out);
+		}
+		countAllocations(state, before);
+		state.SetBytesProcessed(static_cast<int64_t>(bytes));
+	}
+
+	template<typename Serializer, typename Deserializer, typename T>
+	void
+	runRoundTrip(benchmark::State & state, const T & obj)
+	{
+		const std::size_t before = allocations;
+		for (auto _ : state) {
+			std::stringstream strm;
+			Slicer::SerializeAny<Serializer>(obj, strm);
+			benchmark::DoNotOptimize(Slicer::DeserializeAny<Deserializer, T>(strm));
+		}
+		countAllocations(state, before);
+	}
+
+	static void
+	countAllocations(benchmark::State & state, std::size_t before)
+	{
+		state.counters["allocs"] = benchmark::Counter(
+				static_cast<double>(allocations - before), benchmark::Counter::kAvgIterations);
 	}
 };
 
@@ -48,13 +140,16 @@ XML_DESERIALIZE_TEST(someenums, TestModule::SomeEnumsPtr);
 XML_DESERIALIZE_TEST(enum, TestModule::SomeNumbers);
 XML_DESERIALIZE_TEST(elementmap, TestXml::Maps);
 XML_DESERIALIZE_TEST(builtins, TestModule::BuiltInsPtr);
+XML_DESERIALIZE_TEST(datetimes, TestModule::DateTimeContainers);
 XML_DESERIALIZE_TEST(entityref, TestXml::EntityRef);
 XML_DESERIALIZE_TEST(int, int);
+XML_DESERIALIZE_TEST(manyenums, TestModule::ManyEnums);
 XML_DESERIALIZE_TEST(isodate, TestModule::IsoDate);
 XML_DESERIALIZE_TEST(seqOfClass, TestModule::Classes);
 XML_DESERIALIZE_TEST(simpleArray2, TestModule::SimpleSeq);
 XML_DESERIALIZE_TEST(string, std::string);
 XML_DESERIALIZE_TEST(struct, TestModule::StructType);
+XML_DESERIALIZE_TEST(wide, TestModule::WideStruct);
 XML_DESERIALIZE_TEST(xmlattr, TestModule::ClassClassPtr);
 #undef XML_DESERIALIZE_TEST
 
@@ -62,7 +157,9 @@ XML_DESERIALIZE_TEST(xmlattr, TestModule::ClassClassPtr);
 	DESERIALIZE_TEST(name, type, Slicer::JsonValueDeserializer, json, JsonValueFromFile, )
 JSON_DESERIALIZE_TEST(builtins2, TestModule::BuiltInsPtr);
 JSON_DESERIALIZE_TEST(builtins3, TestModule::BuiltInsPtr);
+JSON_DESERIALIZE_TEST(datetimes, TestModule::DateTimeContainers);
 JSON_DESERIALIZE_TEST(localClass, Locals::LocalClassPtr);
+JSON_DESERIALIZE_TEST(manyenums, TestModule::ManyEnums);
 JSON_DESERIALIZE_TEST(localSubClass, Locals::LocalSubClassPtr);
 JSON_DESERIALIZE_TEST(localSub2Class, Locals::LocalSub2ClassPtr);
 JSON_DESERIALIZE_TEST(objectmap, TestJson::Properties);
@@ -74,8 +171,342 @@ JSON_DESERIALIZE_TEST(seqOfClass2, TestModule::Classes);
 JSON_DESERIALIZE_TEST(simpleArray1, TestModule::SimpleSeq);
 JSON_DESERIALIZE_TEST(string2, std::string);
 JSON_DESERIALIZE_TEST(struct2, TestModule::StructType);
+JSON_DESERIALIZE_TEST(wide, TestModule::WideStruct);
 #undef JSON_DESERIALIZE_TEST
 
+struct FileText : public std::string {
+	explicit FileText(const std::filesystem::path & path) :
+		std::string {[&path] {
+			std::ifstream in {path};
+			return std::string {std::istreambuf_iterator<char> {in}, {}};
+		}()}
+	{
+	}
+};
+
+#define JSON_PARSE_DESERIALIZE_TEST(name, type) \
+	BENCHMARK_F(CoreFixture, name##_json_parse_dom)(benchmark::State & state) \
+	{ \
+		const FileText text {rootDir / "initial/" #name ".json"}; \
+		for (auto _ : state) { \
+			std::istringstream in {text}; \
+			benchmark::DoNotOptimize( \
+					Slicer::DeserializeAny<Slicer::JsonValueDeserializer, type>(json::parseValue(in))); \
+		} \
+	} \
+	BENCHMARK_F(CoreFixture, name##_json_parse_stream)(benchmark::State & state) \
+	{ \
+		const FileText text {rootDir / "initial/" #name ".json"}; \
+		for (auto _ : state) { \
+			std::istringstream in {text}; \
+			benchmark::DoNotOptimize(Slicer::DeserializeAny<Slicer::JsonStreamDeserializer, type>(in)); \
+		} \
+	}
+JSON_PARSE_DESERIALIZE_TEST(builtins2, TestModule::BuiltInsPtr);
+JSON_PARSE_DESERIALIZE_TEST(objectmap, TestJson::Properties);
+JSON_PARSE_DESERIALIZE_TEST(seqOfClass2, TestModule::Classes);
+JSON_PARSE_DESERIALIZE_TEST(wide, TestModule::WideStruct);
+#undef JSON_PARSE_DESERIALIZE_TEST
+
+#define XML_PARSE_DESERIALIZE_TEST(name, type) \
+	BENCHMARK_F(CoreFixture, name##_xml_parse_dom)(benchmark::State & state) \
+	{ \
+		const FileText text {rootDir / "initial/" #name ".xml"}; \
+		for (auto _ : state) { \
+			xmlpp::DomParser dom; \
+			dom.parse_memory(text); \
+			benchmark::DoNotOptimize( \
+					Slicer::DeserializeAny<Slicer::XmlDocumentDeserializer, type>(dom.get_document())); \
+		} \
+	} \
+	BENCHMARK_F(CoreFixture, name##_xml_parse_stream)(benchmark::State & state) \
+	{ \
+		const FileText text {rootDir / "initial/" #name ".xml"}; \
+		for (auto _ : state) { \
+			std::istringstream in {text}; \
+			benchmark::DoNotOptimize(Slicer::DeserializeAny<Slicer::XmlStreamDeserializer, type>(in)); \
+		} \
+	}
+XML_PARSE_DESERIALIZE_TEST(attributemap, TestXml::Maps);
+XML_PARSE_DESERIALIZE_TEST(bare, TestXml::BareContainers);
+XML_PARSE_DESERIALIZE_TEST(seqOfClass, TestModule::Classes);
+XML_PARSE_DESERIALIZE_TEST(wide, TestModule::WideStruct);
+#undef XML_PARSE_DESERIALIZE_TEST
+
 #undef DESERIALIZE_TEST
 
+#define JSON_SERIALIZE_TEST(name, type, ser, suf, run) \
+	BENCHMARK_F(CoreFixture, name##_json_##suf)(benchmark::State & state) \
+	{ \
+		const auto obj = Slicer::DeserializeAny<Slicer::JsonFileDeserializer, type>(rootDir / "initial/" #name ".json"); \
+		run<ser>(state, obj); \
+	}
+#define JSON_SERIALIZE_TESTS(name, type) \
+	JSON_SERIALIZE_TEST(name, type, Slicer::JsonStreamSerializer, dom, runSerialize) \
+	JSON_SERIALIZE_TEST(name, type, Slicer::JsonDirectStreamSerializer, direct, runSerialize) \
+	JSON_SERIALIZE_TEST(name, type, Slicer::JsonStaticWriter, static, runSerializeStatic)
+JSON_SERIALIZE_TESTS(builtins2, TestModule::BuiltInsPtr);
+JSON_SERIALIZE_TESTS(datetimes, TestModule::DateTimeContainers);
+JSON_SERIALIZE_TESTS(manyenums, TestModule::ManyEnums);
+JSON_SERIALIZE_TESTS(objectmap, TestJson::Properties);
+JSON_SERIALIZE_TESTS(seqOfClass2, TestModule::Classes);
+JSON_SERIALIZE_TESTS(wide, TestModule::WideStruct);
+#undef JSON_SERIALIZE_TESTS
+#undef JSON_SERIALIZE_TEST
+
+#define XML_SERIALIZE_TEST(name, type, ser, suf, run) \
+	BENCHMARK_F(CoreFixture, name##_xml_##suf)(benchmark::State & state) \
+	{ \
+		const auto obj = Slicer::DeserializeAny<Slicer::XmlFileDeserializer, type>(rootDir / "initial/" #name ".xml"); \
+		run<ser>(state, obj); \
+	}
+#define XML_SERIALIZE_TESTS(name, type) \
+	XML_SERIALIZE_TEST(name, type, Slicer::XmlStreamSerializer, dom, runSerialize) \
+	XML_SERIALIZE_TEST(name, type, Slicer::XmlDirectStreamSerializer, direct, runSerialize) \
+	XML_SERIALIZE_TEST(name, type, Slicer::XmlStaticWriter, static, runSerializeStatic)
+XML_SERIALIZE_TESTS(attributemap, TestXml::Maps);
+XML_SERIALIZE_TESTS(bare, TestXml::BareContainers);
+XML_SERIALIZE_TESTS(datetimes, TestModule::DateTimeContainers);
+XML_SERIALIZE_TESTS(manyenums, TestModule::ManyEnums);
+XML_SERIALIZE_TESTS(seqOfClass, TestModule::Classes);
+XML_SERIALIZE_TESTS(wide, TestModule::WideStruct);
+#undef XML_SERIALIZE_TESTS
+#undef XML_SERIALIZE_TEST
+
+// Generated collections of state.range(0) elements, for scaling curves
+static TestModule::BuiltInSeq
+makeBuiltInSeq(int64_t n)
+{
+	TestModule::BuiltInSeq bis;
+	bis.reserve(static_cast<std::size_t>(n));
+	for (Ice::Int s = 0; s < n; s++) {
+		bis.push_back(std::make_shared<TestModule::BuiltIns>(s % 2 == 0, static_cast<Ice::Byte>(s),
+				static_cast<Ice::Short>(s), s, Ice::Long {s} * 1000, 1.5F, s / 10.0, std::to_string(s)));
+	}
+	return bis;
+}
+
+static TestModule::Classes
+makeClasses(int64_t n)
+{
+	TestModule::Classes cs;
+	cs.reserve(static_cast<std::size_t>(n));
+	for (Ice::Int s = 0; s < n; s++) {
+		cs.push_back(std::make_shared<TestModule::ClassType>(s, -s));
+	}
+	return cs;
+}
+
+static void
+collectionSizes(benchmark::internal::Benchmark * b)
+{
+	b->RangeMultiplier(10)->Range(1, 10000);
+}
+
+#define SIZED_TEST(name, make, suf, call) \
+	BENCHMARK_DEFINE_F(CoreFixture, name##_##suf)(benchmark::State & state) \
+	{ \
+		const auto obj = make(state.range(0)); \
+		call(state, obj); \
+		state.SetItemsProcessed(state.iterations() * state.range(0)); \
+	} \
+	BENCHMARK_REGISTER_F(CoreFixture, name##_##suf)->Apply(collectionSizes);
+
+#define SIZED_TESTS(name, make) \
+	SIZED_TEST(name, make, json_dom, runSerialize<Slicer::JsonStreamSerializer>) \
+	SIZED_TEST(name, make, json_direct, runSerialize<Slicer::JsonDirectStreamSerializer>) \
+	SIZED_TEST(name, make, json_static, runSerializeStatic<Slicer::JsonStaticWriter>) \
+	SIZED_TEST(name, make, xml_dom, runSerialize<Slicer::XmlStreamSerializer>) \
+	SIZED_TEST(name, make, xml_direct, runSerialize<Slicer::XmlDirectStreamSerializer>) \
+	SIZED_TEST(name, make, xml_static, runSerializeStatic<Slicer::XmlStaticWriter>) \
+	SIZED_TEST(name, make, json_roundtrip, \
+			(runRoundTrip<Slicer::JsonStreamSerializer, Slicer::JsonStreamDeserializer>)) \
+	SIZED_TEST(name, make, json_direct_roundtrip, \
+			(runRoundTrip<Slicer::JsonDirectStreamSerializer, Slicer::JsonStreamDeserializer>)) \
+	SIZED_TEST(name, make, xml_roundtrip, \
+			(runRoundTrip<Slicer::XmlStreamSerializer, Slicer::XmlStreamDeserializer>)) \
+	SIZED_TEST(name, make, xml_direct_roundtrip, \
+			(runRoundTrip<Slicer::XmlDirectStreamSerializer, Slicer::XmlStreamDeserializer>))
+SIZED_TESTS(builtInSeq, makeBuiltInSeq);
+SIZED_TESTS(classes, makeClasses);
+#undef SIZED_TESTS
+
+// Generated maps of state.range(0) entries, with values too long for the small string optimisation
+static std::string
+mapKey(int64_t s)
+{
+	return "k" + std::to_string(s);
+}
+
+static std::string
+mapValue(int64_t s)
+{
+	return "a value long enough to be allocated " + std::to_string(s);
+}
+
+static TestJson::StringProperties
+makeObjectMap(int64_t n)
+{
+	TestJson::StringProperties props;
+	for (int64_t s = 0; s < n; s++) {
+		props.emplace(mapKey(s), mapValue(s));
+	}
+	return props;
+}
+
+static TestXml::Maps
+makeAttributeMap(int64_t n)
+{
+	TestXml::Maps maps;
+	for (int64_t s = 0; s < n; s++) {
+		maps.amap.emplace(mapKey(s), mapValue(s));
+	}
+	return maps;
+}
+
+static TestXml::Maps
+makeElementMap(int64_t n)
+{
+	TestXml::Maps maps;
+	for (int64_t s = 0; s < n; s++) {
+		maps.emap.emplace(mapKey(s), mapValue(s));
+	}
+	return maps;
+}
+
+#define SIZED_MAP_TESTS(name, make) \
+	SIZED_TEST(name, make, json_roundtrip, \
+			(runRoundTrip<Slicer::JsonStreamSerializer, Slicer::JsonStreamDeserializer>)) \
+	SIZED_TEST(name, make, xml_roundtrip, \
+			(runRoundTrip<Slicer::XmlStreamSerializer, Slicer::XmlStreamDeserializer>))
+SIZED_MAP_TESTS(objectmap, makeObjectMap);
+SIZED_MAP_TESTS(attributemap, makeAttributeMap);
+SIZED_MAP_TESTS(elementmap, makeElementMap);
+#undef SIZED_MAP_TESTS
+#undef SIZED_TEST
+
+// Generated documents of roughly 1KB, 1MB and 100MB
+static constexpr std::uint64_t CORPUS_SEED {1};
+
+static void
+corpusSizes(benchmark::internal::Benchmark * b)
+{
+	b->Arg(1 << 10)->Arg(1 << 20)->Arg(100 << 20)->Unit(benchmark::kMillisecond);
+}
+
+template<typename T>
+static T
+corpus(const benchmark::State & state)
+{
+	return Slicer::DeserializeAny<Slicer::SyntheticDeserializer, T>(
+			CORPUS_SEED, static_cast<std::size_t>(state.range(0)));
+}
+
+#define CORPUS_TEST(name, type, fmt, ser, deser) \
+	BENCHMARK_DEFINE_F(CoreFixture, name##_corpus_##fmt##_serialize)(benchmark::State & state) \
+	{ \
+		runSerialize<ser>(state, corpus<type>(state)); \
+	} \
+	BENCHMARK_REGISTER_F(CoreFixture, name##_corpus_##fmt##_serialize)->Apply(corpusSizes); \
+	BENCHMARK_DEFINE_F(CoreFixture, name##_corpus_##fmt##_deserialize)(benchmark::State & state) \
+	{ \
+		std::ostringstream out; \
+		Slicer::SerializeAny<ser>(corpus<type>(state), out); \
+		const auto text = std::move(out).str(); \
+		const std::size_t before = allocations; \
+		for (auto _ : state) { \
+			std::istringstream in {text}; \
+			benchmark::DoNotOptimize(Slicer::DeserializeAny<deser, type>(in)); \
+		} \
+		countAllocations(state, before); \
+		state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(text.length())); \
+	} \
+	BENCHMARK_REGISTER_F(CoreFixture, name##_corpus_##fmt##_deserialize)->Apply(corpusSizes);
+#define CORPUS_TESTS(name, type) \
+	CORPUS_TEST(name, type, json, Slicer::JsonDirectStreamSerializer, Slicer::JsonStreamDeserializer) \
+	CORPUS_TEST(name, type, xml, Slicer::XmlDirectStreamSerializer, Slicer::XmlStreamDeserializer)
+CORPUS_TESTS(builtInSeq, TestModule::BuiltInSeq);
+CORPUS_TESTS(classes, TestModule::Classes);
+CORPUS_TESTS(maps, TestXml::Maps);
+#undef CORPUS_TESTS
+#undef CORPUS_TEST
+
+// Speed-up of SerializeParallel against thread count, over a fixed sized collection; 1 thread is the baseline
+static constexpr int64_t PARALLEL_ELEMENTS {1'000'000};
+
+static void
+threadCounts(benchmark::internal::Benchmark * b)
+{
+	b->RangeMultiplier(2)->Range(1, 32)->UseRealTime()->Unit(benchmark::kMillisecond);
+}
+
+#define PARALLEL_TEST(name, make, fmt, ser) \
+	BENCHMARK_DEFINE_F(CoreFixture, name##_parallel_##fmt)(benchmark::State & state) \
+	{ \
+		const auto obj = make(PARALLEL_ELEMENTS); \
+		std::size_t bytes {}; \
+		for (auto _ : state) { \
+			std::ostringstream out; \
+			Slicer::SerializeParallel<ser>(obj, static_cast<unsigned int>(state.range(0)), out); \
+			bytes += out.str().length(); \
+			benchmark::DoNotOptimize(out); \
+		} \
+		state.SetItemsProcessed(state.iterations() * PARALLEL_ELEMENTS); \
+		state.SetBytesProcessed(static_cast<int64_t>(bytes)); \
+	} \
+	BENCHMARK_REGISTER_F(CoreFixture, name##_parallel_##fmt)->Apply(threadCounts);
+#define PARALLEL_TESTS(name, make) \
+	PARALLEL_TEST(name, make, json_direct, Slicer::JsonDirectStreamSerializer) \
+	PARALLEL_TEST(name, make, xml_direct, Slicer::XmlDirectStreamSerializer)
+PARALLEL_TESTS(builtInSeq, makeBuiltInSeq);
+PARALLEL_TESTS(classes, makeClasses);
+#undef PARALLEL_TESTS
+#undef PARALLEL_TEST
+
+#define PARALLEL_READ_TEST(name, make) \
+	BENCHMARK_DEFINE_F(CoreFixture, name##_parallel_read_json)(benchmark::State & state) \
+	{ \
+		using Seq = decltype(make(0)); \
+		std::stringstream text; \
+		Slicer::SerializeAny<Slicer::JsonDirectStreamSerializer>(make(PARALLEL_ELEMENTS), text); \
+		for (auto _ : state) { \
+			std::stringstream in {text.str()}; \
+			benchmark::DoNotOptimize(Slicer::DeserializeParallel<Slicer::JsonStreamDeserializer, Seq>( \
+					static_cast<unsigned int>(state.range(0)), in)); \
+		} \
+		state.SetItemsProcessed(state.iterations() * PARALLEL_ELEMENTS); \
+		state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(text.view().length())); \
+	} \
+	BENCHMARK_REGISTER_F(CoreFixture, name##_parallel_read_json)->Apply(threadCounts);
+PARALLEL_READ_TEST(builtInSeq, makeBuiltInSeq);
+PARALLEL_READ_TEST(classes, makeClasses);
+#undef PARALLEL_READ_TEST
+
+// Building and dropping a document of PARALLEL_ELEMENTS class instances, from the heap or from an arena
+#define ALLOCATION_TEST(name, make, suf, ...) \
+	BENCHMARK_DEFINE_F(CoreFixture, name##_build_drop_##suf)(benchmark::State & state) \
+	{ \
+		using Seq = decltype(make(0)); \
+		std::stringstream text; \
+		Slicer::SerializeAny<Slicer::JsonDirectStreamSerializer>(make(PARALLEL_ELEMENTS), text); \
+		for (auto _ : state) { \
+			std::stringstream in {text.str()}; \
+			__VA_ARGS__; \
+		} \
+		state.SetItemsProcessed(state.iterations() * PARALLEL_ELEMENTS); \
+	} \
+	BENCHMARK_REGISTER_F(CoreFixture, name##_build_drop_##suf)->Unit(benchmark::kMillisecond);
+#define ALLOCATION_TESTS(name, make) \
+	ALLOCATION_TEST(name, make, heap, \
+			benchmark::DoNotOptimize(Slicer::DeserializeAny<Slicer::JsonStreamDeserializer, Seq>(in))) \
+	ALLOCATION_TEST(name, make, arena, std::pmr::monotonic_buffer_resource arena; \
+			benchmark::DoNotOptimize( \
+					Slicer::DeserializeAllocated<Slicer::JsonStreamDeserializer, Seq>(&arena, in))) \
+	ALLOCATION_TEST(name, make, arena_parallel, std::pmr::monotonic_buffer_resource arena; \
+			const Slicer::ClassAllocation allocation {&arena}; \
+			benchmark::DoNotOptimize(Slicer::DeserializeParallel<Slicer::JsonStreamDeserializer, Seq>(0, in)))
+ALLOCATION_TESTS(classes, makeClasses);
+#undef ALLOCATION_TESTS
+#undef ALLOCATION_TEST
+
 BENCHMARK_MAIN();
@@ -12,8 +12,8 @@
 #include <vector>
 
 constexpr std::array<std::pair<std::string_view, size_t>, 12> COMPONENTS_IN_TEST_ICE_ARRAY {
-		{{"classtype.ice", 2}, {"classes.ice", 3}, {"collections.ice", 6}, {"enums.ice", 2}, {"inheritance.ice", 12},
-				{"interfaces.ice", 0}, {"json.ice", 2}, {"locals.ice", 7}, {"optionals.ice", 2}, {"structs.ice", 5},
+		{{"classtype.ice", 2}, {"classes.ice", 3}, {"collections.ice", 6}, {"enums.ice", 2}, {"inheritance.ice", 14},
+				{"interfaces.ice", 0}, {"json.ice", 3}, {"locals.ice", 7}, {"optionals.ice", 2}, {"structs.ice", 5},
 				{"types.ice", 4}, {"xml.ice", 5}}};
 using ComponentsCount = decltype(COMPONENTS_IN_TEST_ICE_ARRAY);
 constexpr std::span<const ComponentsCount::value_type> COMPONENTS_IN_TEST_ICE {COMPONENTS_IN_TEST_ICE_ARRAY};
@@ -21,7 +21,7 @@ constexpr auto COMPONENTS_IN_TEST_ICE_COUNT = std::accumulate(
 		COMPONENTS_IN_TEST_ICE.begin(), COMPONENTS_IN_TEST_ICE.end(), 0U, [](const auto & t, const auto & c) {
 			return t + c.second;
 		});
-static_assert(COMPONENTS_IN_TEST_ICE_COUNT == 50);
+static_assert(COMPONENTS_IN_TEST_ICE_COUNT == 53);
 
 void
 process(Slicer::Slicer & s, const ComponentsCount::value_type & c)
@@ -66,6 +66,14 @@ BOOST_AUTO_TEST_CASE(slicer_metadata_split_many, *boost::unit_test::timeout(5))
 	BOOST_CHECK_EQUAL(md.back(), "values");
 }
 
+BOOST_AUTO_TEST_CASE(slicer_metadata_flags, *boost::unit_test::timeout(5))
+{
+	const Slicer::IceMetaData md {Slice::StringList {"json:object", "slicer:name:value"}};
+	BOOST_CHECK(md.flagSet(Slicer::MetaFlag::JsonObject));
+	BOOST_CHECK(md.flagNotSet(Slicer::MetaFlag::XmlAttribute));
+	BOOST_CHECK(Slicer::IceMetaData {}.flagNotSet(Slicer::MetaFlag::JsonObject));
+}
+
 BOOST_AUTO_TEST_CASE(slicer_test_counts_path, *boost::unit_test::timeout(5))
 {
 	Slicer::Slicer s;
@@ -13,10 +13,14 @@
 #include "inheritance.h"
 #include "optionals.h"
 #include "structs.h"
+#include "synthetic.h"
+#include "wide.h"
 #include "xml/serializer.h"
 #include <Ice/Config.h>
 #include <Ice/Optional.h>
 #include <boost/test/unit_test_log.hpp>
+#include <cstddef>
+#include <cstdint>
 #include <definedDirs.h>
 #include <filesystem>
 #include <fstream>
@@ -31,12 +35,16 @@
 #pragma GCC diagnostic pop
 #include <json.h>
 #include <json/serializer.h>
+#include <jsonExceptions.h>
 #include <jsonpp.h>
 #include <libxml++/document.h>
+#include <libxml++/exceptions/parse_error.h>
+#include <libxml++/parsers/domparser.h>
 #include <libxml2/libxml/parser.h>
 #include <locals.h>
 #include <map>
 #include <memory>
+#include <memory_resource>
 #include <slicer/modelParts.h>
 #include <slicer/modelPartsTypes.h>
 #include <slicer/slicer.h>
@@ -106,6 +114,14 @@ namespace {
 			BOOST_TEST_CHECKPOINT("Serialize " << input << " -> " << outputXml);
 			Slicer::SerializeAny<Slicer::XmlFileSerializer>(p, outputXml);
 
+			const fs::path outputXmlDirect = tmpf / fs::path(infile).replace_extension("direct.xml");
+			BOOST_TEST_CHECKPOINT("Serialize " << input << " -> " << outputXmlDirect);
+			{
+				std::ofstream out(outputXmlDirect);
+				Slicer::SerializeAny<Slicer::XmlDirectStreamSerializer>(p, out);
+			}
+			diff(outputXml, outputXmlDirect);
+
 			if (check) {
 				BOOST_TEST_CHECKPOINT("Check2: " << input);
 				check(p);
@@ -438,6 +454,18 @@ BOOST_AUTO_TEST_CASE(xml_classOfEnums_xml)
 	verifyByFile<TestModule::SomeEnumsPtr, Slicer::XmlFileDeserializer>("someenums.xml", checkSomeEnums);
 }
 
+BOOST_AUTO_TEST_CASE(xml_manyEnums_xml)
+{
+	verifyByFile<TestModule::ManyEnums, Slicer::XmlFileDeserializer>("manyenums.xml", [](const auto & me) {
+		BOOST_REQUIRE_EQUAL(me.wide.size(), 2000);
+		BOOST_REQUIRE_EQUAL(me.sparse.size(), 2000);
+		BOOST_CHECK(me.wide[1] == TestModule::WideEnum::we037);
+		BOOST_CHECK(me.wide[7] == TestModule::WideEnum::we003);
+		BOOST_CHECK(me.sparse[1] == TestModule::SparseEnum::sp013);
+		BOOST_CHECK(me.sparse[5] == TestModule::SparseEnum::sp001);
+	});
+}
+
 BOOST_AUTO_TEST_CASE(xml_rootEnums_xml)
 {
 	verifyByFile<TestModule::SomeNumbers, Slicer::XmlFileDeserializer>("enum.xml", checkSomeNumbers);
@@ -539,6 +567,13 @@ BOOST_AUTO_TEST_CASE(json_streams)
 	diff(inFile, outFile);
 }
 
+BOOST_AUTO_TEST_CASE(json_direct_escaping)
+{
+	std::stringstream out;
+	Slicer::SerializeAny<Slicer::JsonDirectStreamSerializer>(std::string {"q\"b\\s\n\t\x01/\xc3\xa9"}, out);
+	BOOST_CHECK_EQUAL(out.str(), R"J("q\"b\\s\n\t\u0001/)J" "\xc3\xa9\"");
+}
+
 BOOST_AUTO_TEST_CASE(xml_streams)
 {
 	const auto tmpf = binDir / "byStream";
@@ -614,6 +649,71 @@ BOOST_AUTO_TEST_CASE(DeserializeJsonAbstractImpl)
 	BOOST_CHECK_EQUAL("value", impl->testVal);
 }
 
+BOOST_AUTO_TEST_CASE(DeserializeJsonStreamTypeIdFirst)
+{
+	std::stringstream in {
+			R"J({ "obj": {"slicer-typeid": "::Functions::FuncsSub", "skip": [{"x": [1, "]\"}"]}], "Test-Value": "value"} })J"};
+	auto obj = Slicer::DeserializeAny<Slicer::JsonStreamDeserializer, Functions::SFuncs>(in);
+	auto impl = std::dynamic_pointer_cast<Functions::FuncsSub>(obj.obj);
+	BOOST_REQUIRE(impl);
+	BOOST_CHECK_EQUAL("value", impl->testVal);
+}
+
+BOOST_AUTO_TEST_CASE(DeserializeJsonStreamTypeIdLast)
+{
+	std::stringstream in {R"J({ "obj": {"Test-Value": "value", "slicer-typeid": "::Functions::FuncsSub"} })J"};
+	auto obj = Slicer::DeserializeAny<Slicer::JsonStreamDeserializer, Functions::SFuncs>(in);
+	auto impl = std::dynamic_pointer_cast<Functions::FuncsSub>(obj.obj);
+	BOOST_REQUIRE(impl);
+	BOOST_CHECK_EQUAL("value", impl->testVal);
+}
+
+namespace {
+	// Like a pipe, can't be sought back over
+	class UnseekableBuffer : public std::stringbuf {
+	public:
+		using std::stringbuf::stringbuf;
+
+	protected:
+		pos_type
+		seekoff(off_type, std::ios_base::seekdir, std::ios_base::openmode) override
+		{
+			return pos_type(off_type(-1));
+		}
+
+		pos_type
+		seekpos(pos_type, std::ios_base::openmode) override
+		{
+			return pos_type(off_type(-1));
+		}
+	};
+}
+
+BOOST_AUTO_TEST_CASE(DeserializeJsonStreamTypeIdLastUnseekable)
+{
+	UnseekableBuffer buf {
+			R"J({ "obj": {"Test-Value": "value", "skip": {"a": [1, "}"]}, "slicer-typeid": "::Functions::FuncsSub"} })J"};
+	std::istream in {&buf};
+	auto obj = Slicer::DeserializeAny<Slicer::JsonStreamDeserializer, Functions::SFuncs>(in);
+	auto impl = std::dynamic_pointer_cast<Functions::FuncsSub>(obj.obj);
+	BOOST_REQUIRE(impl);
+	BOOST_CHECK_EQUAL("value", impl->testVal);
+}
+
+BOOST_AUTO_TEST_CASE(DeserializeJsonStreamTrailingText)
+{
+	std::stringstream in {R"J({ "obj": null } junk)J"};
+	BOOST_CHECK_THROW((std::ignore = Slicer::DeserializeAny<Slicer::JsonStreamDeserializer, Functions::SFuncs>(in)),
+			Slicer::BadJsonSyntax);
+}
+
+BOOST_AUTO_TEST_CASE(DeserializeJsonStreamBadSyntax)
+{
+	std::stringstream in {R"J({ "obj": {"Test-Value": "value",} })J"};
+	BOOST_CHECK_THROW((std::ignore = Slicer::DeserializeAny<Slicer::JsonStreamDeserializer, Functions::SFuncs>(in)),
+			Slicer::BadJsonSyntax);
+}
+
 BOOST_AUTO_TEST_CASE(DeserializeXmlAbstractEmpty)
 {
 	std::stringstream in("<SFuncs/>");
@@ -643,6 +743,29 @@ BOOST_AUTO_TEST_CASE(DeserializeXmlAbstractImpl)
 	BOOST_CHECK_EQUAL("value", impl->testVal);
 }
 
+BOOST_AUTO_TEST_CASE(DeserializeXmlStreamSkipsUnknown)
+{
+	std::stringstream in(R"X(
+			<SFuncs xmlns:x="urn:x">
+				<unknown><obj slicer-typeid="::Functions::FuncsSub"/>text</unknown>
+				<obj x:extra="1" slicer-typeid="::Functions::FuncsSub">
+					<!-- comment -->
+					<Test-Value>value</Test-Value>
+				</obj>
+			</SFuncs>)X");
+	auto obj = Slicer::DeserializeAny<Slicer::XmlStreamDeserializer, Functions::SFuncs>(in);
+	auto impl = std::dynamic_pointer_cast<Functions::FuncsSub>(obj.obj);
+	BOOST_REQUIRE(impl);
+	BOOST_CHECK_EQUAL("value", impl->testVal);
+}
+
+BOOST_AUTO_TEST_CASE(DeserializeXmlStreamMalformed)
+{
+	std::stringstream in("<SFuncs><obj></SFuncs>");
+	BOOST_CHECK_THROW((std::ignore = Slicer::DeserializeAny<Slicer::XmlStreamDeserializer, Functions::SFuncs>(in)),
+			xmlpp::parse_error);
+}
+
 BOOST_AUTO_TEST_CASE(SerializeJsonClassMap)
 {
 	TestModule::ClassMap d;
@@ -670,6 +793,184 @@ BOOST_AUTO_TEST_CASE(customerModelPartCounters)
 	BOOST_REQUIRE_EQUAL(22, TestModule::completions);
 }
 
+// Tests below here complete further validated parts, beyond those counted above
+
+namespace {
+	template<typename T>
+	void
+	verifyJsonDirectStream(const std::string & file)
+	{
+		// The direct writer's output differs from the DOM's only in key order; round trip it and compare via the DOM
+		const auto tmpf = binDir / "byDirectStream";
+		const auto inFile = rootDir / "initial" / file;
+		const auto outFile = tmpf / file;
+		fs::create_directories(tmpf);
+		std::stringstream direct;
+		{
+			std::ifstream in(inFile.string());
+			auto d = Slicer::DeserializeAny<Slicer::JsonStreamDeserializer, T>(in);
+			Slicer::SerializeAny<Slicer::JsonDirectStreamSerializer>(d, direct);
+		}
+		{
+			auto d = Slicer::DeserializeAny<Slicer::JsonStreamDeserializer, T>(direct);
+			std::ofstream out(outFile.string());
+			Slicer::SerializeAny<Slicer::JsonStreamSerializer>(d, out);
+		}
+		diff(inFile, outFile);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(json_direct_streams)
+{
+	verifyJsonDirectStream<TestModule::InheritanceContPtr>("inherit-c.json");
+	verifyJsonDirectStream<TestModule::BuiltInsPtr>("builtins2.json");
+	verifyJsonDirectStream<TestModule::Classes>("seqOfClass2.json");
+	verifyJsonDirectStream<TestModule::Optionals2Ptr>("optionals3.json");
+	verifyJsonDirectStream<TestJson::Properties>("objectmap.json");
+	verifyJsonDirectStream<TestJson::HasProperitiesPtr>("objectmapMember.json");
+	verifyJsonDirectStream<Locals::LocalClassPtr>("localSub2Class.json");
+	verifyJsonDirectStream<std::string>("string2.json");
+}
+
+template<typename Serializer>
+static std::string
+serializeTypeIdNamedMember()
+{
+	const TestModule::Base3Ptr d = std::make_shared<TestModule::D14>("member", 2);
+	std::stringstream out;
+	Slicer::SerializeAny<Serializer>(d, out);
+	return out.str();
+}
+
+BOOST_AUTO_TEST_CASE(json_typeid_named_member)
+{
+	// Both writers emit the type id in place of a member named like its property
+	for (const auto & text : {serializeTypeIdNamedMember<Slicer::JsonStreamSerializer>(),
+				 serializeTypeIdNamedMember<Slicer::JsonDirectStreamSerializer>()}) {
+		BOOST_TEST_CONTEXT(text) {
+			BOOST_CHECK_EQUAL(text.find(R"("kind")"), text.rfind(R"("kind")"));
+			BOOST_CHECK_NE(text.find(R"("kind":"::TestModule::D14")"), std::string::npos);
+			std::stringstream in {text};
+			const auto d = Slicer::DeserializeAny<Slicer::JsonStreamDeserializer, TestModule::Base3Ptr>(in);
+			BOOST_CHECK(std::dynamic_pointer_cast<TestModule::D14>(d));
+		}
+	}
+}
+
+namespace {
+	template<typename T, typename Deserializer, typename Serializer, typename Writer>
+	void
+	verifyStatic(const std::string & file)
+	{
+		BOOST_TEST_CONTEXT(file) {
+			const auto d = Slicer::DeserializeAny<Deserializer, T>(rootDir / "initial" / file);
+			std::stringstream direct;
+			std::stringstream statically;
+			Slicer::SerializeAny<Serializer>(d, direct);
+			Slicer::SerializeStatic<Writer>(d, statically);
+			BOOST_CHECK_EQUAL(direct.str(), statically.str());
+		}
+	}
+
+	template<typename T>
+	void
+	verifyStaticJson(const std::string & file)
+	{
+		verifyStatic<T, Slicer::JsonFileDeserializer, Slicer::JsonDirectStreamSerializer, Slicer::JsonStaticWriter>(
+				file);
+	}
+
+	template<typename T>
+	void
+	verifyStaticXml(const std::string & file)
+	{
+		verifyStatic<T, Slicer::XmlFileDeserializer, Slicer::XmlDirectStreamSerializer, Slicer::XmlStaticWriter>(
+				file);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(json_static)
+{
+	verifyStaticJson<TestModule::BuiltInsPtr>("builtins2.json");
+	verifyStaticJson<TestModule::Classes>("seqOfClass2.json");
+	verifyStaticJson<TestModule::OptionalsPtr>("optionals-areset2.json");
+	verifyStaticJson<TestModule::InheritanceContPtr>("inherit-c.json");
+	verifyStaticJson<TestJson::Properties>("objectmap.json");
+	verifyStaticJson<TestJson::HasProperitiesPtr>("objectmapMember.json");
+	verifyStaticJson<Locals::LocalClassPtr>("localSub2Class.json");
+	verifyStaticJson<TestModule::ManyEnums>("manyenums.json");
+	verifyStaticJson<TestModule::DateTimeContainers>("datetimes.json");
+	verifyStaticJson<std::string>("string2.json");
+}
+
+BOOST_AUTO_TEST_CASE(xml_static)
+{
+	verifyStaticXml<TestModule::BuiltInsPtr>("builtins.xml");
+	verifyStaticXml<TestModule::StructType>("struct.xml");
+	verifyStaticXml<TestModule::Classes>("seqOfClass.xml");
+	verifyStaticXml<TestModule::OptionalsPtr>("optionals-areset.xml");
+	verifyStaticXml<TestModule::OptionalsPtr>("optionals-notset.xml");
+	verifyStaticXml<TestModule::InheritanceContPtr>("inherit-b.xml");
+	verifyStaticXml<TestModule::DateTimeContainerPtr>("conv-datetime.xml");
+	verifyStaticXml<TestModule::ClassClassPtr>("xmlattr.xml");
+	verifyStaticXml<TestXml::BareContainers>("bare.xml");
+	verifyStaticXml<TestXml::Maps>("attributemap.xml");
+	verifyStaticXml<TestModule::WideStruct>("wide.xml");
+	verifyStaticXml<int>("int.xml");
+}
+
+namespace {
+	template<typename Deserializer>
+	void
+	verifyProjected(const std::string & file)
+	{
+		BOOST_TEST_CONTEXT(file) {
+			std::ifstream in((rootDir / "initial" / file).string());
+			const auto o = Slicer::DeserializeProjected<Deserializer, TestModule::OptionalsPtr>(
+					{"optSimple", "optStruct.b", "optSeq.a", "optDict.b"}, in);
+			BOOST_REQUIRE(o);
+			BOOST_CHECK_EQUAL(o->optSimple, 4);
+			BOOST_REQUIRE(o->optStruct);
+			BOOST_CHECK_EQUAL(o->optStruct->a, 0);
+			BOOST_CHECK_EQUAL(o->optStruct->b, 2);
+			BOOST_CHECK(!o->optClass);
+			BOOST_CHECK(!o->optConverted);
+			BOOST_REQUIRE(o->optSeq);
+			BOOST_REQUIRE_EQUAL(o->optSeq->size(), 2);
+			BOOST_CHECK_EQUAL(o->optSeq->front()->a, 3);
+			BOOST_CHECK_EQUAL(o->optSeq->front()->b, 0);
+			BOOST_CHECK_EQUAL(o->optSeq->back()->a, 5);
+			BOOST_REQUIRE(o->optDict);
+			BOOST_REQUIRE_EQUAL(o->optDict->size(), 2);
+			BOOST_CHECK_EQUAL(o->optDict->at(10)->a, 0);
+			BOOST_CHECK_EQUAL(o->optDict->at(10)->b, 12);
+			BOOST_CHECK_EQUAL(o->optDict->at(13)->b, 15);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(json_projected)
+{
+	verifyProjected<Slicer::JsonStreamDeserializer>("optionals-areset2.json");
+}
+
+BOOST_AUTO_TEST_CASE(xml_projected)
+{
+	verifyProjected<Slicer::XmlStreamDeserializer>("optionals-areset.xml");
+}
+
+BOOST_AUTO_TEST_CASE(projected_everything)
+{
+	std::ifstream in((rootDir / "initial" / "optionals-areset2.json").string());
+	const auto o = Slicer::DeserializeProjected<Slicer::JsonStreamDeserializer, TestModule::OptionalsPtr>(
+			Slicer::Projection {}, in);
+	BOOST_REQUIRE(o);
+	BOOST_REQUIRE(o->optClass && *o->optClass);
+	BOOST_CHECK_EQUAL((*o->optClass)->dt.year, 2017);
+	BOOST_REQUIRE(o->optStruct);
+	BOOST_CHECK_EQUAL(o->optStruct->a, 1);
+}
+
 BOOST_AUTO_TEST_CASE(enum_lookups)
 {
 	BOOST_CHECK_EQUAL("One", Slicer::ModelPartForEnum<TestModule::SomeNumbers>::lookup(TestModule::SomeNumbers::One));
@@ -724,3 +1025,228 @@ BOOST_AUTO_TEST_CASE(dict_with_name_overrides)
 			rootDir / "initial/dictNamed.xml");
 	BOOST_REQUIRE_EQUAL(res.size(), 2);
 }
+
+template<typename T, typename Serializer = Slicer::JsonStreamSerializer>
+static std::string
+synthetic(std::uint64_t seed, std::size_t size)
+{
+	std::stringstream out;
+	Slicer::SerializeAny<Serializer>(Slicer::DeserializeAny<Slicer::SyntheticDeserializer, T>(seed, size), out);
+	return std::move(out).str();
+}
+
+template<typename T, typename Serializer, typename Deserializer>
+static void
+verifySyntheticRoundTrip()
+{
+	const auto text = synthetic<T, Serializer>(3, 4096);
+	std::stringstream in {text}, out;
+	Slicer::SerializeAny<Serializer>(Slicer::DeserializeAny<Deserializer, T>(in), out);
+	BOOST_CHECK_EQUAL(text, out.view());
+}
+
+template<typename T>
+static void
+verifySynthetic()
+{
+	BOOST_CHECK_EQUAL(synthetic<T>(1, 4096), synthetic<T>(1, 4096));
+	BOOST_CHECK_NE(synthetic<T>(1, 4096), synthetic<T>(2, 4096));
+	verifySyntheticRoundTrip<T, Slicer::JsonStreamSerializer, Slicer::JsonStreamDeserializer>();
+	verifySyntheticRoundTrip<T, Slicer::XmlStreamSerializer, Slicer::XmlStreamDeserializer>();
+}
+
+BOOST_AUTO_TEST_CASE(synthetic_corpus)
+{
+	verifySynthetic<TestModule::BuiltInSeq>();
+	verifySynthetic<TestModule::ManyEnums>();
+	verifySynthetic<TestXml::Maps>();
+}
+
+BOOST_AUTO_TEST_CASE(synthetic_corpus_size)
+{
+	for (const std::size_t size : {1U << 10, 1U << 16}) {
+		const auto length = synthetic<TestModule::BuiltInSeq>(1, size).length();
+		BOOST_CHECK_GE(length, size / 2);
+		BOOST_CHECK_LE(length, size * 2);
+	}
+}
+
+template<typename Serializer, typename Seq>
+static void
+verifyParallel(const Seq & seq)
+{
+	std::stringstream sequential;
+	Slicer::SerializeAny<Serializer>(seq, sequential);
+	for (const auto threads : {1U, 3U, 0U}) {
+		BOOST_TEST_CONTEXT(seq.size() << " elements, " << threads << " threads") {
+			std::stringstream parallel;
+			Slicer::SerializeParallel<Serializer>(seq, threads, parallel);
+			BOOST_CHECK_EQUAL(sequential.view(), parallel.view());
+		}
+	}
+}
+
+template<typename Seq>
+static void
+verifyParallel(const Seq & seq)
+{
+	verifyParallel<Slicer::JsonDirectStreamSerializer>(seq);
+	verifyParallel<Slicer::XmlDirectStreamSerializer>(seq);
+}
+
+BOOST_AUTO_TEST_CASE(parallel_serialize)
+{
+	verifyParallel(Slicer::DeserializeAny<Slicer::SyntheticDeserializer, TestModule::BuiltInSeq>(1, 1U << 16));
+	verifyParallel(Slicer::DeserializeAny<Slicer::SyntheticDeserializer, TestModule::Classes>(1, 1U << 16));
+	verifyParallel(Slicer::DeserializeAny<Slicer::SyntheticDeserializer, TestModule::SimpleSeq>(1, 1U << 16));
+	verifyParallel(TestModule::SimpleSeq {});
+	verifyParallel(TestModule::SimpleSeq {"one"});
+	// Null elements are omitted, including from the start of the output and all of it
+	verifyParallel(TestModule::Classes {nullptr, std::make_shared<TestModule::ClassType>(1, 2), nullptr});
+	verifyParallel(TestModule::Classes {nullptr, nullptr});
+}
+
+template<typename Seq>
+static void
+verifyParallelDeserialize(const Seq & seq)
+{
+	std::stringstream text;
+	Slicer::SerializeAny<Slicer::JsonStreamSerializer>(seq, text);
+	for (const auto threads : {1U, 3U, 0U}) {
+		BOOST_TEST_CONTEXT(seq.size() << " elements, " << threads << " threads") {
+			std::stringstream in {text.str()}, out;
+			const auto parallel
+					= Slicer::DeserializeParallel<Slicer::JsonStreamDeserializer, Seq>(threads, in);
+			BOOST_CHECK_EQUAL(parallel.size(), seq.size());
+			Slicer::SerializeAny<Slicer::JsonStreamSerializer>(parallel, out);
+			BOOST_CHECK_EQUAL(text.view(), out.view());
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(parallel_deserialize)
+{
+	verifyParallelDeserialize(
+			Slicer::DeserializeAny<Slicer::SyntheticDeserializer, TestModule::BuiltInSeq>(1, 1U << 16));
+	verifyParallelDeserialize(Slicer::DeserializeAny<Slicer::SyntheticDeserializer, TestModule::Classes>(1, 1U << 16));
+	verifyParallelDeserialize(TestModule::SimpleSeq {});
+	verifyParallelDeserialize(TestModule::SimpleSeq {"one"});
+	verifyParallelDeserialize(TestModule::SimpleSeq {"[", "\"],{", "\\"});
+}
+
+BOOST_AUTO_TEST_CASE(parallel_deserialize_subclasses)
+{
+	TestModule::BaseSeq seq;
+	for (Ice::Int i = 0; i < 1000; i++) {
+		seq.push_back(std::make_shared<TestModule::D1>(i, i + 1));
+		seq.push_back(std::make_shared<TestModule::D3>(i, i + 2, i + 3));
+		seq.push_back(nullptr);
+	}
+	verifyParallelDeserialize(seq);
+
+	std::stringstream text;
+	Slicer::SerializeAny<Slicer::JsonStreamSerializer>(seq, text);
+	const auto parallel = Slicer::DeserializeParallel<Slicer::JsonStreamDeserializer, TestModule::BaseSeq>(0, text);
+	BOOST_REQUIRE_EQUAL(parallel.size(), seq.size());
+	BOOST_CHECK(std::dynamic_pointer_cast<TestModule::D1>(parallel[2997]));
+	BOOST_CHECK(std::dynamic_pointer_cast<TestModule::D3>(parallel[2998]));
+	BOOST_CHECK(!parallel[2999]);
+}
+
+BOOST_AUTO_TEST_CASE(parallel_deserialize_bad_syntax)
+{
+	for (const auto bad : {"", "{}", R"(["a", "b")", R"(["a" "b"])", R"(["a",,"b"])", R"(["a",})", "[] x",
+				 R"(["a"] "b")"}) {
+		BOOST_TEST_CONTEXT(bad) {
+			std::stringstream in {bad};
+			BOOST_CHECK_THROW((std::ignore = Slicer::DeserializeParallel<Slicer::JsonStreamDeserializer,
+									   TestModule::SimpleSeq>(2, in)),
+					Slicer::BadJsonSyntax);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(parallel_deserialize_trailing_text)
+{
+	std::stringstream in {R"(["a", "b"] junk)"};
+	BOOST_CHECK_EXCEPTION((std::ignore = Slicer::DeserializeParallel<Slicer::JsonStreamDeserializer,
+								   TestModule::SimpleSeq>(2, in)),
+			Slicer::BadJsonSyntax, [](const Slicer::BadJsonSyntax & e) {
+				return e.offset == 11;
+			});
+}
+
+BOOST_AUTO_TEST_CASE(deserialize_allocated)
+{
+	TestModule::BaseSeq seq;
+	for (Ice::Int i = 0; i < 100; i++) {
+		seq.push_back(std::make_shared<TestModule::D1>(i, i + 1));
+		seq.push_back(std::make_shared<TestModule::D3>(i, i + 2, i + 3));
+		seq.push_back(nullptr);
+	}
+	std::stringstream text, out;
+	Slicer::SerializeAny<Slicer::JsonStreamSerializer>(seq, text);
+
+	std::vector<std::byte> arena(1U << 20);
+	std::pmr::monotonic_buffer_resource resource {arena.data(), arena.size(), std::pmr::null_memory_resource()};
+	const auto allocated
+			= Slicer::DeserializeAllocated<Slicer::JsonStreamDeserializer, TestModule::BaseSeq>(&resource, text);
+	BOOST_REQUIRE_EQUAL(allocated.size(), seq.size());
+	for (const auto & element : allocated) {
+		if (element) {
+			const auto address = reinterpret_cast<const std::byte *>(element.get());
+			BOOST_CHECK(address >= arena.data() && address < arena.data() + arena.size());
+		}
+	}
+	BOOST_CHECK(std::dynamic_pointer_cast<TestModule::D3>(allocated[1]));
+	Slicer::SerializeAny<Slicer::JsonStreamSerializer>(allocated, out);
+	BOOST_CHECK_EQUAL(text.view(), out.view());
+	// Outside of the scope, the heap is used again
+	BOOST_CHECK(!Slicer::ClassAllocation::current());
+}
+
+BOOST_AUTO_TEST_CASE(parallel_deserialize_allocated)
+{
+	TestModule::BaseSeq seq;
+	for (Ice::Int i = 0; i < 100; i++) {
+		seq.push_back(std::make_shared<TestModule::D1>(i, i + 1));
+		seq.push_back(std::make_shared<TestModule::D3>(i, i + 2, i + 3));
+	}
+	std::stringstream text;
+	Slicer::SerializeAny<Slicer::JsonStreamSerializer>(seq, text);
+
+	std::vector<std::byte> arena(1U << 20);
+	std::pmr::monotonic_buffer_resource resource {arena.data(), arena.size(), std::pmr::null_memory_resource()};
+	const Slicer::ClassAllocation allocation {&resource};
+	// Worker threads allocate from the same, not thread safe, resource
+	const auto allocated = Slicer::DeserializeParallel<Slicer::JsonStreamDeserializer, TestModule::BaseSeq>(3, text);
+	BOOST_REQUIRE_EQUAL(allocated.size(), seq.size());
+	for (const auto & element : allocated) {
+		const auto address = reinterpret_cast<const std::byte *>(element.get());
+		BOOST_CHECK(address >= arena.data() && address < arena.data() + arena.size());
+	}
+}
+
+BOOST_AUTO_TEST_CASE(size_hints_reserve)
+{
+	TestModule::SimpleSeq seq;
+	for (auto n = 0; n < 1000; n++) {
+		seq.push_back(std::to_string(n));
+	}
+	std::stringstream jsonText, xmlText;
+	Slicer::SerializeAny<Slicer::JsonStreamSerializer>(seq, jsonText);
+	Slicer::SerializeAny<Slicer::XmlStreamSerializer>(seq, xmlText);
+
+	// Filled without reallocating, so without spare capacity
+	const auto fromJson
+			= Slicer::DeserializeAny<Slicer::JsonValueDeserializer, TestModule::SimpleSeq>(json::parseValue(jsonText));
+	BOOST_CHECK_EQUAL_COLLECTIONS(fromJson.begin(), fromJson.end(), seq.begin(), seq.end());
+	BOOST_CHECK_EQUAL(fromJson.capacity(), seq.size());
+
+	xmlpp::DomParser dom;
+	dom.parse_memory(xmlText.str());
+	const auto fromXml
+			= Slicer::DeserializeAny<Slicer::XmlDocumentDeserializer, TestModule::SimpleSeq>(dom.get_document());
+	BOOST_CHECK_EQUAL_COLLECTIONS(fromXml.begin(), fromXml.end(), seq.begin(), seq.end());
+	BOOST_CHECK_EQUAL(fromXml.capacity(), seq.size());
+}
@@ -3,13 +3,17 @@
 
 #include "helpers.h"
 #include "streams.h"
+#include <classtype.h>
 #include <collections.h>
+#include <cstddef>
 #include <definedDirs.h>
 #include <filesystem>
+#include <fstream>
 #include <json/serializer.h>
 #include <slicer/modelPartsTypes.h>
 #include <slicer/slicer.h>
 #include <string>
+#include <utility>
 #include <vector>
 #include <xml/serializer.h>
 
@@ -35,6 +39,16 @@ BOOST_AUTO_TEST_CASE(streamToXml)
 	BOOST_REQUIRE_EQUAL("9", seq.back());
 }
 
+BOOST_AUTO_TEST_CASE(streamToXmlDirect)
+{
+	const auto outputXml = binDir / "streamOutDirect.xml";
+	{
+		std::ofstream out(outputXml);
+		Slicer::SerializeAny<Slicer::XmlDirectStreamSerializer, const TestStream>(*this, out);
+	}
+	diff(rootDir / "expected" / "streamOut.xml", outputXml);
+}
+
 BOOST_AUTO_TEST_CASE(streamToJson)
 {
 	const auto outputJson = binDir / "streamOut.json";
@@ -46,4 +60,78 @@ BOOST_AUTO_TEST_CASE(streamToJson)
 	BOOST_REQUIRE_EQUAL("9", seq.back());
 }
 
+BOOST_AUTO_TEST_CASE(streamToJsonDirect)
+{
+	const auto outputJson = binDir / "streamOutDirect.json";
+	{
+		std::ofstream out(outputJson);
+		Slicer::SerializeAny<Slicer::JsonDirectStreamSerializer, const TestStream>(*this, out);
+	}
+	diff(rootDir / "expected" / "streamOut.json", outputJson);
+}
+
+BOOST_AUTO_TEST_CASE(streamFromJson)
+{
+	std::ifstream in {rootDir / "expected" / "streamOut.json"};
+	std::vector<std::string> seq;
+	Slicer::DeserializeEach<Slicer::JsonStreamDeserializer, std::string>(
+			[&seq](std::string && s) {
+				seq.push_back(std::move(s));
+			},
+			in);
+	BOOST_REQUIRE_EQUAL(10, seq.size());
+	BOOST_REQUIRE_EQUAL("0", seq.front());
+	BOOST_REQUIRE_EQUAL("9", seq.back());
+}
+
+BOOST_AUTO_TEST_CASE(streamFromXml)
+{
+	std::ifstream in {rootDir / "expected" / "streamOut.xml"};
+	std::vector<std::string> seq;
+	Slicer::DeserializeEach<Slicer::XmlStreamDeserializer, std::string>(
+			[&seq](std::string && s) {
+				seq.push_back(std::move(s));
+			},
+			in);
+	BOOST_REQUIRE_EQUAL(10, seq.size());
+	BOOST_REQUIRE_EQUAL("0", seq.front());
+	BOOST_REQUIRE_EQUAL("9", seq.back());
+}
+
+BOOST_AUTO_TEST_CASE(streamClassesFromJson)
+{
+	const auto all = Slicer::DeserializeAny<Slicer::JsonFileDeserializer, TestModule::Classes>(
+			rootDir / "initial" / "seqOfClass2.json");
+	std::ifstream in {rootDir / "initial" / "seqOfClass2.json"};
+	std::size_t n {};
+	Slicer::DeserializeEach<Slicer::JsonStreamDeserializer, TestModule::ClassTypePtr>(
+			[&all, &n](TestModule::ClassTypePtr && c) {
+				BOOST_REQUIRE_LT(n, all.size());
+				BOOST_REQUIRE(c);
+				BOOST_CHECK_EQUAL(all[n]->a, c->a);
+				BOOST_CHECK_EQUAL(all[n]->b, c->b);
+				n++;
+			},
+			in);
+	BOOST_REQUIRE_EQUAL(all.size(), n);
+}
+
+BOOST_AUTO_TEST_CASE(streamClassesFromXml)
+{
+	const auto all = Slicer::DeserializeAny<Slicer::XmlFileDeserializer, TestModule::Classes>(
+			rootDir / "initial" / "seqOfClass.xml");
+	std::ifstream in {rootDir / "initial" / "seqOfClass.xml"};
+	std::size_t n {};
+	Slicer::DeserializeEach<Slicer::XmlStreamDeserializer, TestModule::ClassTypePtr>(
+			[&all, &n](TestModule::ClassTypePtr && c) {
+				BOOST_REQUIRE_LT(n, all.size());
+				BOOST_REQUIRE(c);
+				BOOST_CHECK_EQUAL(all[n]->a, c->a);
+				BOOST_CHECK_EQUAL(all[n]->b, c->b);
+				n++;
+			},
+			in);
+	BOOST_REQUIRE_EQUAL(all.size(), n);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
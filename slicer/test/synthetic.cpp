@@ -0,0 +1,257 @@
+#include "synthetic.h"
+#include <Ice/Config.h>
+#include <algorithm>
+#include <exception>
+#include <slicer/modelPartsTypes.h>
+#include <span>
+#include <string>
+#include <string_view>
+#include <typeinfo>
+
+namespace Slicer {
+	namespace {
+		// Letters first; strings start with one so they're also valid XML names
+		constexpr std::string_view characters {"abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789"};
+		constexpr std::size_t letters {52};
+
+		[[nodiscard]] constexpr bool
+		isCollection(ModelPartType type)
+		{
+			return type == ModelPartType::Sequence || type == ModelPartType::Dictionary;
+		}
+
+		// Names of the possible values of an enumeration, if that's what mp is (or optionally contains)
+		[[nodiscard]] std::span<const std::string * const>
+		enumerationsOf(ModelPartParam mp)
+		{
+			if (const auto * const enumPart = dynamic_cast<const ModelPartForEnumBase *>(&*mp)) {
+				return enumPart->GetEnumerations();
+			}
+			std::span<const std::string * const> names;
+			if (mp->IsOptional()) {
+				mp->OnContained([&names](auto && cmp) {
+					names = enumerationsOf(cmp);
+				});
+			}
+			return names;
+		}
+	}
+
+	// Values are kept positive and small integers smaller still, which keeps the likes of non-zero and
+	// day/month validators happy more often than not.
+	class SyntheticDeserializer::RandomValueSource : public ValueSource, public TValueSource<std::string_view> {
+	public:
+		RandomValueSource(SyntheticDeserializer & g, std::span<const std::string * const> e) :
+			gen(g), enumerations(e)
+		{
+		}
+
+		void
+		set(bool & v) const override
+		{
+			v = gen.next(2) != 0;
+			gen.spend(5);
+		}
+
+		void
+		set(Ice::Byte & v) const override
+		{
+			v = static_cast<Ice::Byte>(1 + gen.next(31));
+			gen.spend(2);
+		}
+
+		void
+		set(Ice::Short & v) const override
+		{
+			v = static_cast<Ice::Short>(1 + gen.next(31));
+			gen.spend(2);
+		}
+
+		void
+		set(Ice::Int & v) const override
+		{
+			v = static_cast<Ice::Int>(1 + gen.next(1'000'000));
+			gen.spend(6);
+		}
+
+		void
+		set(Ice::Long & v) const override
+		{
+			v = static_cast<Ice::Long>(1 + gen.next(1'000'000'000'000));
+			gen.spend(12);
+		}
+
+		void
+		set(Ice::Float & v) const override
+		{
+			v = static_cast<Ice::Float>(gen.next(1'000'000)) / 100.F;
+			gen.spend(8);
+		}
+
+		void
+		set(Ice::Double & v) const override
+		{
+			v = static_cast<Ice::Double>(gen.next(1'000'000'000)) / 1000.;
+			gen.spend(10);
+		}
+
+		void
+		set(std::string & v) const override
+		{
+			if (!enumerations.empty()) {
+				v = *enumerations[gen.next(enumerations.size())];
+			}
+			else {
+				v.resize(1 + gen.next(16));
+				v.front() = characters[gen.next(letters)];
+				std::generate(v.begin() + 1, v.end(), [this] {
+					return characters[gen.next(characters.length())];
+				});
+			}
+			gen.spend(v.length() + 2);
+		}
+
+		// Enumeration symbols are viewed where they're stored; anything else is generated into text
+		void
+		set(std::string_view & v) const override
+		{
+			if (enumerations.empty()) {
+				set(text);
+				v = text;
+				return;
+			}
+			v = *enumerations[gen.next(enumerations.size())];
+			gen.spend(v.length() + 2);
+		}
+
+		[[nodiscard]] const void *
+		exchange(ExchangeType t) const override
+		{
+			return exchangeFor<Slicer::TValueSource, std::string_view>(this, t);
+		}
+
+	private:
+		SyntheticDeserializer & gen;
+		std::span<const std::string * const> enumerations;
+		mutable std::string text;
+	};
+
+	SyntheticDeserializer::SyntheticDeserializer(std::uint64_t seed, std::size_t targetBytes) :
+		rng(seed), remaining(targetBytes)
+	{
+	}
+
+	void
+	SyntheticDeserializer::Deserialize(ModelPartForRootParam modelRoot)
+	{
+		modelRoot->OnAnonChild(
+				[this](auto && mp, auto &&) {
+					fill(mp, 0);
+				},
+				{});
+	}
+
+	void
+	SyntheticDeserializer::fill(ModelPartParam mp, std::size_t stopAt)
+	{
+		switch (mp->GetType()) {
+			case ModelPartType::Simple:
+				return fillSimple(mp);
+			case ModelPartType::Complex:
+				return fillComplex(mp);
+			case ModelPartType::Sequence:
+			case ModelPartType::Dictionary:
+				return fillCollection(mp, stopAt);
+			case ModelPartType::Null:
+				return;
+		}
+	}
+
+	void
+	SyntheticDeserializer::fillSimple(ModelPartParam mp)
+	{
+		const std::type_index type {typeid(*mp)};
+		if (unsettable.contains(type)) {
+			return;
+		}
+		mp->Create();
+		for (auto attempt = 0U; attempt < MAX_ATTEMPTS; attempt++) {
+			try {
+				mp->SetValue(RandomValueSource {*this, enumerationsOf(mp)});
+				mp->Complete();
+				return;
+			}
+			catch (const std::exception &) {
+				// Rejected by a conversion or validator, try another value
+			}
+		}
+		unsettable.insert(type);
+	}
+
+	void
+	SyntheticDeserializer::fillComplex(ModelPartParam mp)
+	{
+		mp->Create();
+		// Outermost collections share the remaining budget between them
+		std::size_t collections {};
+		if (!inCollection) {
+			mp->OnEachChild([&collections](auto &&, auto && cmp, auto &&) {
+				collections += isCollection(cmp->GetType());
+			});
+		}
+		depth += 1;
+		mp->OnEachChild([this, &collections](const auto & name, auto && cmp, auto &&) {
+			const auto type = cmp->GetType();
+			const auto share = (!inCollection && isCollection(type)) ? remaining / collections-- : 0;
+			if (cmp->IsOptional() && next(4) == 0) {
+				return;
+			}
+			// Classes can recurse, stop before they do forever
+			if (depth >= MAX_DEPTH && type != ModelPartType::Simple) {
+				return;
+			}
+			spend(name.length() + 3);
+			fill(cmp, remaining - std::min(share, remaining));
+		});
+		depth -= 1;
+		mp->Complete();
+	}
+
+	void
+	SyntheticDeserializer::fillCollection(ModelPartParam mp, std::size_t stopAt)
+	{
+		const auto element = [this](auto && emp, auto &&) {
+			fill(emp, 0);
+		};
+		mp->Create();
+		if (inCollection) {
+			auto n = next(MAX_NESTED_ELEMENTS + 1);
+			mp->SizeHint(std::min<std::size_t>(n, remaining));
+			for (; n && remaining; n--) {
+				spend(1);
+				mp->OnAnonChild(element);
+			}
+		}
+		else {
+			inCollection = true;
+			while (remaining > stopAt) {
+				spend(1);
+				mp->OnAnonChild(element);
+			}
+			inCollection = false;
+		}
+		mp->Complete();
+	}
+
+	std::uint64_t
+	SyntheticDeserializer::next(std::uint64_t n)
+	{
+		return rng() % n;
+	}
+
+	void
+	SyntheticDeserializer::spend(std::size_t bytes)
+	{
+		remaining -= std::min(bytes, remaining);
+	}
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <slicer/modelParts.h>
+#include <slicer/serializer.h>
+#include <typeindex>
+#include <unordered_set>
+#include <visibility.h>
+
+namespace Slicer {
+	// Fills any Slicer type with random content through its ModelPart, for benchmark corpora. Output is
+	// reproducible for a given seed; collections grow until roughly targetBytes of (JSON sized) content
+	// has been generated, shared evenly between the outermost collections.
+	class DLL_PUBLIC SyntheticDeserializer : public Deserializer {
+	public:
+		SyntheticDeserializer(std::uint64_t seed, std::size_t targetBytes);
+
+		void Deserialize(ModelPartForRootParam) override;
+
+		static constexpr unsigned int MAX_DEPTH {8};
+		static constexpr unsigned int MAX_NESTED_ELEMENTS {4};
+		static constexpr unsigned int MAX_ATTEMPTS {32};
+
+	private:
+		class RandomValueSource;
+
+		// Collections outside any other stop growing once remaining drops to stopAt
+		void fill(ModelPartParam, std::size_t stopAt);
+		void fillSimple(ModelPartParam);
+		void fillComplex(ModelPartParam);
+		void fillCollection(ModelPartParam, std::size_t stopAt);
+
+		// In [0, n), near uniformly; not std::uniform_int_distribution, which differs between standard libraries
+		[[nodiscard]] std::uint64_t next(std::uint64_t n);
+		void spend(std::size_t bytes);
+
+		std::mt19937_64 rng;
+		std::size_t remaining;
+		unsigned int depth {};
+		bool inCollection {};
+		// Parts which never accepted a random value (conversions or validators), left at their defaults
+		std::unordered_set<std::type_index> unsettable;
+	};
+}
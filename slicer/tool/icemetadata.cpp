@@ -11,6 +11,7 @@ namespace Slicer {
 		std::for_each(as.begin(), as.end(), [this](auto a) {
 			auto & md = arr.emplace_back(std::move(a), std::string_view {});
 			md.second = std::string_view(md.first).substr(0, md.first.rfind(':'));
+			_flags |= flagOf(md.first);
 		});
 		_begin = arr.begin();
 		_end = arr.end();
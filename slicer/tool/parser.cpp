@@ -152,6 +152,63 @@ namespace Slicer {
 		const Count & count;
 	};
 
+	class StaticDeclare : public Slice::ParserVisitor {
+	public:
+		explicit StaticDeclare(FILE * c) : cpp(c) { }
+
+		bool
+		visitClassDefStart(const Slice::ClassDefPtr & c) override
+		{
+			if (!c->isInterface() && !ignoreType(c)) {
+				declare(Slice::typeToString(c->declaration()));
+			}
+			return false;
+		}
+
+		bool
+		visitStructStart(const Slice::StructPtr & s) override
+		{
+			if (!ignoreType(s)) {
+				declare(s->scoped());
+			}
+			return false;
+		}
+
+		void
+		visitSequence(const Slice::SequencePtr & s) override
+		{
+			if (!ignoreType(s)) {
+				declare(s->scoped());
+			}
+		}
+
+		void
+		visitDictionary(const Slice::DictionaryPtr & d) override
+		{
+			if (!ignoreType(d)) {
+				declare(d->scoped());
+			}
+		}
+
+		void
+		visitEnum(const Slice::EnumPtr & e) override
+		{
+			if (!ignoreType(e)) {
+				declare(e->scoped());
+			}
+		}
+
+	private:
+		void
+		declare(const std::string & type) const
+		{
+			fprintbf(cpp, "template<> DLL_PUBLIC void StaticWalker< %s >::walk(StaticWriter &, const %s &);\n", type,
+					type);
+		}
+
+		FILE * cpp;
+	};
+
 	SplitString::SplitString(std::string_view in, std::string_view by)
 	{
 		boost::algorithm::split(*this, in, boost::algorithm::is_any_of(by), boost::algorithm::token_compress_off);
@@ -169,7 +226,7 @@ namespace Slicer {
 		return o;
 	}
 
-	Slicer::Slicer() : cpp(nullptr), headerPrefix("slicer"), components(0), classNo(0) { }
+	Slicer::Slicer() : cpp(nullptr), headerPrefix("slicer"), staticWalkers(false), components(0), classNo(0) { }
 
 	void
 	Slicer::defineConversions(const Slice::DataMemberPtr & dm) const
@@ -298,6 +355,12 @@ namespace Slicer {
 			include("map", true);
 			include("utility", true);
 		}
+		if (staticWalkers) {
+			include((headerPrefix / "staticSerializer.h").string());
+			if (count.classes) {
+				include("typeinfo");
+			}
+		}
 		ForwardDeclare fd {cpp, count};
 		u->visit(&fd, true);
 
@@ -310,6 +373,11 @@ namespace Slicer {
 		}
 		fprintbf(cpp, "\n");
 		fprintbf(cpp, "namespace Slicer {\n");
+		if (staticWalkers) {
+			StaticDeclare sd {cpp};
+			u->visit(&sd, true);
+			fprintbf(cpp, "\n");
+		}
 		return true;
 	}
 
@@ -443,7 +511,7 @@ namespace Slicer {
 		if (auto implementation = md.value("slicer:implementation:")) {
 			fprintbf(cpp, "\ttemplate<> void ModelPartForClass<%s>::Create() {\n", c->scoped());
 			fprintf(cpp, "\t\tBOOST_ASSERT(this->Model);\n");
-			fprintbf(cpp, "\t\t*this->Model = std::make_shared<%s>();\n}\n\n", CppName {*implementation});
+			fprintbf(cpp, "\t\t*this->Model = ClassAllocation::make<%s>();\n}\n\n", CppName {*implementation});
 		}
 
 		if (auto cmp = md.value("slicer:custommodelpart:")) {
@@ -458,6 +526,7 @@ namespace Slicer {
 					Slice::typeToString(decl), c->scoped(), c->scoped());
 		}
 		definedTypes.insert(decl->typeId());
+		defineStaticWalker(Slice::typeToString(decl), md, c->scoped(), c->allDataMembers());
 
 		classNo += 1;
 
@@ -487,6 +556,7 @@ namespace Slicer {
 		defineGetMetadata(md, c, "ModelPartForComplex");
 
 		defineMODELPART(c->scoped(), c, md);
+		defineStaticWalker(c->scoped(), md, {}, c->dataMembers());
 
 		return true;
 	}
@@ -559,8 +629,11 @@ namespace Slicer {
 			fprintbf(cpp, "\tCONSTSTR(%d) estr_E%d_%s { \"%s\" };\n", ee->name().length(), components, ee->name(),
 					ee->name());
 		}
-		fprintbf(cpp, "constexpr const EnumMapImpl< %s, %d > enumerations%d {{{\n", e->scoped(),
-				e->enumerators().size(), components);
+		// Value indexed lookup table unless the enumerator values are sparse, then binary search
+		const auto count = e->enumerators().size();
+		const auto range = static_cast<std::size_t>(e->maxValue() - e->minValue()) + 1;
+		fprintbf(cpp, "constexpr const EnumMapImpl< %s, %d, %d > enumerations%d {{{\n", e->scoped(), count,
+				range <= count * 4 ? range : 0, components);
 		for (const auto & ee : e->enumerators()) {
 			fprintbf(cpp, "\t {%s, \"%s\", &estr_E%d_%s},\n", ee->scoped(), ee->name(), components, ee->name());
 		}
@@ -575,6 +648,17 @@ namespace Slicer {
 		defineRoot(e->scoped(), name ? *name : e->name(), t);
 
 		defineMODELPART(e->scoped(), e, md);
+
+		if (staticWalkers) {
+			defineStaticWalkerStart(e->scoped());
+			if (formatSpecific(md)) {
+				defineStaticFallback("\t");
+			}
+			else {
+				fprintbf(cpp, "\tw.value(ModelPartForEnum< %s >::lookup(v));\n", e->scoped());
+			}
+			fprintbf(cpp, "}\n\n");
+		}
 	}
 
 	void
@@ -604,6 +688,23 @@ namespace Slicer {
 		defineGetMetadata(md, s, "ModelPartForSequence");
 
 		defineMODELPART(s->scoped(), s, md);
+
+		if (staticWalkers) {
+			defineStaticWalkerStart(s->scoped());
+			if (formatSpecific(md)) {
+				defineStaticFallback("\t");
+			}
+			else {
+				fprintbf(cpp, "\tw.beginArray();\n");
+				fprintbf(cpp, "\tfor (const auto & e : v) {\n");
+				fprintbf(cpp, "\t\tif (staticHasValue(e)) {\n");
+				fprintbf(cpp, "\t\t\tw.beginElement(ModelPartForSequence< %s >::elementName);\n", s->scoped());
+				fprintbf(cpp, "\t\t\tStaticWalker< %s >::walk(w, e);\n", Slice::typeToString(s->type()));
+				fprintbf(cpp, "\t\t\tw.endElement();\n\t\t}\n\t}\n");
+				fprintbf(cpp, "\tw.endArray();\n");
+			}
+			fprintbf(cpp, "}\n\n");
+		}
 	}
 
 	void
@@ -659,6 +760,30 @@ namespace Slicer {
 		defineGetMetadata(md, d, "ModelPartForComplex", "::value_type");
 
 		defineMODELPART(d->scoped(), d, md);
+
+		if (staticWalkers) {
+			defineStaticWalkerStart(d->scoped());
+			if (formatSpecific(md)) {
+				defineStaticFallback("\t");
+			}
+			else {
+				fprintbf(cpp, "\tw.beginArray();\n");
+				fprintbf(cpp, "\tfor (const auto & e : v) {\n");
+				fprintbf(cpp, "\t\tw.beginElement(ModelPartForDictionary< %s >::pairName);\n", d->scoped());
+				fprintbf(cpp, "\t\tw.beginObject();\n");
+				fprintbf(cpp, "\t\tw.beginMember(hstr_C%d_first);\n", components);
+				fprintbf(cpp, "\t\tStaticWalker< %s >::walk(w, e.first);\n", Slice::typeToString(d->keyType()));
+				fprintbf(cpp, "\t\tw.endMember();\n");
+				fprintbf(cpp, "\t\tif (staticHasValue(e.second)) {\n");
+				fprintbf(cpp, "\t\t\tw.beginMember(hstr_C%d_second);\n", components);
+				fprintbf(cpp, "\t\t\tStaticWalker< %s >::walk(w, e.second);\n", Slice::typeToString(d->valueType()));
+				fprintbf(cpp, "\t\t\tw.endMember();\n\t\t}\n");
+				fprintbf(cpp, "\t\tw.endObject();\n");
+				fprintbf(cpp, "\t\tw.endElement();\n\t}\n");
+				fprintbf(cpp, "\tw.endArray();\n");
+			}
+			fprintbf(cpp, "}\n\n");
+		}
 	}
 
 	void
@@ -669,6 +794,72 @@ namespace Slicer {
 		}
 	}
 
+	void
+	Slicer::defineStaticWalker(const std::string & type, const IceMetaData & md, const std::string & className,
+			const Slice::DataMemberList & dataMembers) const
+	{
+		if (!staticWalkers) {
+			return;
+		}
+
+		defineStaticWalkerStart(type);
+		// Format specific metadata (attributes, bare containers, etc) is left to the serializer's ModelPart path
+		if (formatSpecific(md) || std::any_of(dataMembers.begin(), dataMembers.end(), [](const auto & dm) {
+				return formatSpecific(getAllMetadata(dm));
+			})) {
+			defineStaticFallback("\t");
+			fprintbf(cpp, "}\n\n");
+			return;
+		}
+		const std::string_view access {className.empty() ? "." : "->"};
+		if (!className.empty()) {
+			// Subclasses carry a type id, let the ModelPart path handle them
+			fprintbf(cpp, "\tif (typeid(*v) != typeid(%s)) {\n", className);
+			defineStaticFallback("\t\t");
+			fprintbf(cpp, "\t\treturn;\n\t}\n");
+		}
+		fprintbf(cpp, "\tw.beginObject();\n");
+		for (const auto & dm : dataMembers) {
+			const IceMetaData mmd {getAllMetadata(dm)};
+			const auto memberType = Slice::typeToString(dm->type(), dm->optional());
+			if (!getConversions(mmd).empty() || mmd.value("slicer:custommodelpart:")) {
+				fprintbf(cpp, "\tModelPart::Make< ");
+				createNewModelPartPtrFor(dm->type(), dm, mmd);
+				fprintbf(cpp, " >(const_cast< %s * >(&v%s%s), [&w](auto && mp) {\n", memberType, access, dm->name());
+				fprintbf(cpp, "\t\tw.fallbackMember(hstr_C%d_%s, mp);\n\t});\n", components, dm->name());
+			}
+			else {
+				fprintbf(cpp, "\tif (staticHasValue(v%s%s)) {\n", access, dm->name());
+				fprintbf(cpp, "\t\tw.beginMember(hstr_C%d_%s);\n", components, dm->name());
+				fprintbf(cpp, "\t\tStaticWalker< %s >::walk(w, v%s%s);\n", memberType, access, dm->name());
+				fprintbf(cpp, "\t\tw.endMember();\n\t}\n");
+			}
+		}
+		fprintbf(cpp, "\tw.endObject();\n");
+		fprintbf(cpp, "}\n\n");
+	}
+
+	void
+	Slicer::defineStaticWalkerStart(const std::string & type) const
+	{
+		fprintbf(cpp, "template<> DLL_PUBLIC void StaticWalker< %s >::walk(StaticWriter & w, const %s & v)\n{\n",
+				type, type);
+	}
+
+	void
+	Slicer::defineStaticFallback(std::string_view indent) const
+	{
+		fprintbf(cpp, "%sModelPart::CreateFor(&v, [&w](auto && mp) {\n", indent);
+		fprintbf(cpp, "%s\tw.fallback(mp);\n%s});\n", indent, indent);
+	}
+
+	bool
+	Slicer::formatSpecific(const IceMetaData & md)
+	{
+		return !md.values("slicer:json").empty() || !md.values("slicer:xml").empty()
+				|| md.value("slicer:custommodelpart:");
+	}
+
 	void
 	Slicer::createModelPartForConverted(
 			const Slice::TypePtr & type, const std::string & container, const Slice::DataMemberPtr & dm) const
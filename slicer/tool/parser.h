@@ -47,6 +47,7 @@ namespace Slicer {
 		std::filesystem::path cppPath;
 		std::filesystem::path headerPrefix;
 		std::vector<std::filesystem::path> includes;
+		bool staticWalkers;
 
 		unsigned int Execute();
 		[[nodiscard]] unsigned int Components() const;
@@ -86,6 +87,12 @@ namespace Slicer {
 				std::string_view tsuf = {}) const;
 		void externType(const Slice::TypePtr &) const;
 
+		void defineStaticWalker(const std::string & type, const IceMetaData & md, const std::string & className,
+				const Slice::DataMemberList & dataMembers) const;
+		void defineStaticWalkerStart(const std::string & type) const;
+		void defineStaticFallback(std::string_view indent) const;
+		static bool formatSpecific(const IceMetaData & md);
+
 		void copyMetadata(const IceMetaData & metadata) const;
 		static IceMetaData getAllMetadata(const Slice::DataMemberPtr & dm);
 		static Conversions getConversions(const IceMetaData & metadata);
@@ -62,6 +62,7 @@ main(int argc, char ** argv)
 		// NOLINTNEXTLINE(clang-analyzer-optin.cplusplus.VirtualCall)
 		("headerPrefix", po::value(&slicer.headerPrefix)->default_value(slicer.headerPrefix), "Prefix path for Slicer C++ #includes")
 		("post,p", po::value(&post)->default_value(defaultPostProcessor()), "Post-process command")
+		("static", po::bool_switch(&slicer.staticWalkers), "Also generate StaticWalkers for SerializeStatic")
 		("slice,i", po::value(&slicer.slicePath), "Input ICE Slice file")
 		("cpp,o", po::value(&slicer.cppPath), "Output C++ file");
 	// clang-format on
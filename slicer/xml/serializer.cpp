@@ -1,6 +1,8 @@
 #include "serializer.h"
+#include <algorithm>
 #include <charconv>
 #include <compileTimeFormatter.h>
+#include <cstddef>
 #include <functional>
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wold-style-cast"
@@ -11,22 +13,31 @@
 #include <glibmm/ustring.h>
 #include <libxml++/attribute.h>
 #include <libxml++/document.h>
+#include <libxml++/exceptions/internal_error.h>
+#include <libxml++/exceptions/parse_error.h>
 #include <libxml++/nodes/contentnode.h>
 #include <libxml++/nodes/element.h>
 #include <libxml++/nodes/node.h>
-#include <libxml++/parsers/domparser.h>
+#include <libxml/xmlreader.h>
+#include <libxml/xmlwriter.h>
 #pragma GCC diagnostic pop
 #include <Ice/Config.h>
 #include <boost/numeric/conversion/cast.hpp>
 #include <factory.h>
 #include <lazyPointer.h>
 #include <list>
+#include <memory>
 #include <optional>
+#include <ostream>
 #include <slicer/metadata.h>
 #include <slicer/modelParts.h>
+#include <slicer/parallel.h>
 #include <slicer/serializer.h>
+#include <sstream>
+#include <string>
 #include <string_view>
 #include <utility>
+#include <vector>
 #include <xmlExceptions.h>
 // IWYU pragma: no_include <boost/detail/basic_pointerbuf.hpp>
 
@@ -34,14 +45,97 @@ NAMEDFACTORY(".xml", Slicer::XmlFileSerializer, Slicer::FileSerializerFactory)
 NAMEDFACTORY(".xml", Slicer::XmlFileDeserializer, Slicer::FileDeserializerFactory)
 NAMEDFACTORY("application/xml", Slicer::XmlStreamSerializer, Slicer::StreamSerializerFactory)
 NAMEDFACTORY("application/xml", Slicer::XmlStreamDeserializer, Slicer::StreamDeserializerFactory)
+NAMEDFACTORY("application/xml+direct", Slicer::XmlDirectStreamSerializer, Slicer::StreamSerializerFactory)
 
 namespace Slicer {
+	class XmlTextWriter {
+	public:
+		explicit XmlTextWriter(std::ostream & strm) :
+			writer {xmlNewTextWriter(xmlOutputBufferCreateIO(&XmlTextWriter::write, nullptr, &strm, nullptr)),
+					&xmlFreeTextWriter}
+		{
+			if (!writer) {
+				throw xmlpp::internal_error("Failed to create XML text writer");
+			}
+		}
+
+		void
+		startDocument()
+		{
+			check(xmlTextWriterStartDocument(writer.get(), nullptr, "UTF-8", nullptr));
+		}
+
+		void
+		endDocument()
+		{
+			check(xmlTextWriterEndDocument(writer.get()));
+			check(xmlTextWriterFlush(writer.get()));
+		}
+
+		void
+		startElement(const std::string & name)
+		{
+			check(xmlTextWriterStartElement(writer.get(), xmlStr(name.c_str())));
+		}
+
+		void
+		endElement()
+		{
+			check(xmlTextWriterEndElement(writer.get()));
+		}
+
+		void
+		attribute(const std::string & name, const Glib::ustring & value)
+		{
+			check(xmlTextWriterWriteAttribute(writer.get(), xmlStr(name.c_str()), xmlStr(value.c_str())));
+		}
+
+		void
+		text(const Glib::ustring & value)
+		{
+			check(xmlTextWriterWriteString(writer.get(), xmlStr(value.c_str())));
+		}
+
+		// Already serialized content, written as is
+		void
+		raw(const std::string & content)
+		{
+			check(xmlTextWriterWriteRawLen(
+					writer.get(), xmlStr(content.c_str()), boost::numeric_cast<int>(content.length())));
+		}
+
+		void
+		flush()
+		{
+			check(xmlTextWriterFlush(writer.get()));
+		}
+
+	private:
+		static const xmlChar *
+		xmlStr(const char * s)
+		{
+			return reinterpret_cast<const xmlChar *>(s);
+		}
+
+		static void
+		check(int rc)
+		{
+			if (rc < 0) {
+				throw xmlpp::internal_error("XML text writer failed");
+			}
+		}
+
+		static int
+		write(void * strm, const char * buf, int len)
+		{
+			static_cast<std::ostream *>(strm)->write(buf, len);
+			return len;
+		}
+
+		std::unique_ptr<xmlTextWriter, decltype(&xmlFreeTextWriter)> writer;
+	};
+
 	namespace {
-		constexpr std::string_view md_attribute {"xml:attribute"};
-		constexpr std::string_view md_text {"xml:text"};
-		constexpr std::string_view md_bare {"xml:bare"};
-		constexpr std::string_view md_attributes {"xml:attributes"};
-		constexpr std::string_view md_elements {"xml:elements"};
 		constexpr std::string_view keyName {"key"};
 		constexpr std::string_view valueName {"value"};
 
@@ -55,7 +149,7 @@ namespace Slicer {
 		const Glib::ustring TrueText("true");
 		const Glib::ustring FalseText("false");
 
-		class XmlValueSource : public ValueSource {
+		class XmlValueSource : public ValueSource, public TValueSource<std::string_view> {
 		public:
 			explicit XmlValueSource() = default;
 
@@ -68,11 +162,11 @@ namespace Slicer {
 			void
 			set(bool & v) const override
 			{
-				if (value == TrueText) {
+				if (value.raw() == TrueText.raw()) {
 					v = true;
 					return;
 				}
-				if (value == FalseText) {
+				if (value.raw() == FalseText.raw()) {
 					v = false;
 					return;
 				}
@@ -121,6 +215,18 @@ namespace Slicer {
 				v = value.raw();
 			}
 
+			void
+			set(std::string_view & v) const override
+			{
+				v = value.raw();
+			}
+
+			[[nodiscard]] const void *
+			exchange(ExchangeType t) const override
+			{
+				return exchangeFor<Slicer::TValueSource, std::string_view>(this, t);
+			}
+
 		private:
 			template<typename T>
 			void
@@ -225,9 +331,22 @@ namespace Slicer {
 		void DocumentTreeIterateDictAttrs(const xmlpp::Element::const_AttributeList & attrs, ModelPartParam dict);
 		void DocumentTreeIterateDictElements(const xmlpp::Element * parent, ModelPartParam dict);
 
+		std::size_t
+		countChildElements(const xmlpp::Element * element)
+		{
+			std::size_t count {};
+			for (auto node = element->get_first_child(); node; node = node->get_next_sibling()) {
+				if (dynamic_cast<const xmlpp::Element *>(node)) {
+					count++;
+				}
+			}
+			return count;
+		}
+
 		void
 		DocumentTreeIterateDictAttrs(const xmlpp::Element::const_AttributeList & attrs, ModelPartParam dict)
 		{
+			dict->SizeHint(attrs.size());
 			for (const auto & attr : attrs) {
 				dict->OnAnonChild([&attr](auto && emp, auto &&) {
 					emp->Create();
@@ -251,6 +370,7 @@ namespace Slicer {
 		void
 		DocumentTreeIterateDictElements(const xmlpp::Element * element, ModelPartParam dict)
 		{
+			dict->SizeHint(countChildElements(element));
 			auto node = element->get_first_child();
 			while (node) {
 				if (auto childElement = dynamic_cast<const xmlpp::Element *>(node)) {
@@ -279,16 +399,20 @@ namespace Slicer {
 		{
 			auto oec = [&md, element](const auto & lmp) {
 				lmp->Create();
-				if (md.flagSet(md_attributes)) {
+				if (md.flagSet(MetaFlag::XmlAttributes)) {
 					auto attrs(element->get_attributes());
 					if (!attrs.empty()) {
 						DocumentTreeIterateDictAttrs(attrs, lmp);
 					}
 				}
-				else if (md.flagSet(md_elements)) {
+				else if (md.flagSet(MetaFlag::XmlElements)) {
 					DocumentTreeIterateDictElements(element, lmp);
 				}
 				else {
+					if (const auto type = lmp->GetType();
+							type == ModelPartType::Sequence || type == ModelPartType::Dictionary) {
+						lmp->SizeHint(countChildElements(element));
+					}
 					auto attrs(element->get_attributes());
 					if (!attrs.empty()) {
 						DocumentTreeIterate(attrs.front(), lmp);
@@ -318,7 +442,7 @@ namespace Slicer {
 				if (auto element = dynamic_cast<const xmlpp::Element *>(node)) {
 					mp->OnChild(
 							[element](auto && smp, auto && md) {
-								if (md.flagSet(md_bare)) {
+								if (md.flagSet(MetaFlag::XmlBare)) {
 									smp->OnAnonChild([element](auto && bmp, auto && bmd) {
 										DocumentTreeIterateElement(element, bmp, bmd);
 									});
@@ -328,7 +452,7 @@ namespace Slicer {
 							},
 							element->get_name(),
 							[](const auto & h) {
-								return h->GetMetadata().flagNotSet(md_attribute);
+								return !h->flagSet(MetaFlag::XmlAttribute);
 							});
 				}
 				else if (auto attribute = dynamic_cast<const xmlpp::Attribute *>(node)) {
@@ -340,7 +464,7 @@ namespace Slicer {
 							},
 							attribute->get_name(),
 							[](const auto & h) {
-								return h->GetMetadata().flagSet(md_attribute);
+								return h->flagSet(MetaFlag::XmlAttribute);
 							});
 				}
 				else if (auto content = dynamic_cast<const xmlpp::ContentNode *>(node)) {
@@ -351,7 +475,7 @@ namespace Slicer {
 									smp->SetValue(XmlValueSource(content));
 								},
 								[](const auto & h) {
-									return h->GetMetadata().flagSet(md_text);
+									return h->flagSet(MetaFlag::XmlText);
 								}));
 					}
 					if (!bare) {
@@ -368,6 +492,318 @@ namespace Slicer {
 			DocumentTreeIterate(doc->get_root_node(), mp);
 		}
 
+		class XmlStreamReader {
+		public:
+			using Attributes = std::vector<std::pair<std::string, Glib::ustring>>;
+
+			explicit XmlStreamReader(std::istream & strm) :
+				reader {xmlReaderForIO(&XmlStreamReader::read, nullptr, &strm, nullptr, nullptr, 0), &xmlFreeTextReader}
+			{
+				if (!reader) {
+					throw xmlpp::internal_error("Failed to create XML text reader");
+				}
+			}
+
+			explicit XmlStreamReader(const std::filesystem::path & path) :
+				reader {xmlReaderForFile(path.c_str(), nullptr, 0), &xmlFreeTextReader}
+			{
+				if (!reader) {
+					throw xmlpp::parse_error("Failed to open " + path.string());
+				}
+			}
+
+			bool
+			next()
+			{
+				const auto rc = xmlTextReaderRead(reader.get());
+				if (rc < 0) {
+					const auto * err = xmlGetLastError();
+					throw xmlpp::parse_error(err && err->message ? err->message : "Failed to parse XML");
+				}
+				return rc == 1;
+			}
+
+			[[nodiscard]] int
+			type() const
+			{
+				return xmlTextReaderNodeType(reader.get());
+			}
+
+			[[nodiscard]] int
+			depth() const
+			{
+				return xmlTextReaderDepth(reader.get());
+			}
+
+			[[nodiscard]] bool
+			empty() const
+			{
+				return xmlTextReaderIsEmptyElement(reader.get()) == 1;
+			}
+
+			[[nodiscard]] Glib::ustring
+			name() const
+			{
+				return str(xmlTextReaderConstLocalName(reader.get()));
+			}
+
+			[[nodiscard]] Glib::ustring
+			value() const
+			{
+				return str(xmlTextReaderConstValue(reader.get()));
+			}
+
+			// Attributes of the current element, excluding namespace declarations
+			[[nodiscard]] Attributes
+			attributes()
+			{
+				Attributes attrs;
+				if (xmlTextReaderMoveToFirstAttribute(reader.get()) == 1) {
+					do {
+						if (xmlTextReaderIsNamespaceDecl(reader.get()) != 1) {
+							attrs.emplace_back(name(), value());
+						}
+					} while (xmlTextReaderMoveToNextAttribute(reader.get()) == 1);
+					xmlTextReaderMoveToElement(reader.get());
+				}
+				return attrs;
+			}
+
+			// Consume the rest of the current element
+			void
+			skip()
+			{
+				if (type() == XML_READER_TYPE_ELEMENT && !empty()) {
+					const auto d = depth();
+					while (next() && (type() != XML_READER_TYPE_END_ELEMENT || depth() != d)) { }
+				}
+			}
+
+		private:
+			static std::string
+			str(const xmlChar * s)
+			{
+				return s ? reinterpret_cast<const char *>(s) : "";
+			}
+
+			static int
+			read(void * strm, char * buf, int len)
+			{
+				auto & in = *static_cast<std::istream *>(strm);
+				in.read(buf, len);
+				return in.bad() ? -1 : static_cast<int>(in.gcount());
+			}
+
+			std::unique_ptr<xmlTextReader, decltype(&xmlFreeTextReader)> reader;
+		};
+
+		constexpr auto notAttribute = [](const auto & h) {
+			return !h->flagSet(MetaFlag::XmlAttribute);
+		};
+		constexpr auto isAttribute = [](const auto & h) {
+			return h->flagSet(MetaFlag::XmlAttribute);
+		};
+		constexpr auto isText = [](const auto & h) {
+			return h->flagSet(MetaFlag::XmlText);
+		};
+
+		bool
+		isWhiteSpace(int type, const Glib::ustring & content)
+		{
+			switch (type) {
+				case XML_READER_TYPE_WHITESPACE:
+				case XML_READER_TYPE_SIGNIFICANT_WHITESPACE:
+					return true;
+				case XML_READER_TYPE_TEXT:
+				case XML_READER_TYPE_CDATA:
+					return content.raw().find_first_not_of(" \t\n\r") == std::string::npos;
+				default:
+					return false;
+			}
+		}
+
+		// As DocumentTreeIterate*, but driven node by node from an xmlTextReader
+		void DocumentStreamIterateChild(XmlStreamReader & reader, ModelPartParam mp);
+		bool DocumentStreamIterateChildren(XmlStreamReader & reader, ModelPartParam mp);
+		void DocumentStreamIterateElement(XmlStreamReader & reader, ModelPartParam mp, const Metadata & md);
+		void DocumentStreamIterateDictAttrs(const XmlStreamReader::Attributes & attrs, ModelPartParam dict);
+		void DocumentStreamIterateDictElements(XmlStreamReader & reader, ModelPartParam dict);
+
+		void
+		DocumentStreamIterateDictAttrs(const XmlStreamReader::Attributes & attrs, ModelPartParam dict)
+		{
+			for (const auto & [name, value] : attrs) {
+				dict->OnAnonChild([&name, &value](auto && emp, auto &&) {
+					emp->Create();
+					emp->OnChild(
+							[&name](auto && child, auto &&) {
+								child->SetValue(XmlValueSource(name));
+								child->Complete();
+							},
+							keyName);
+					emp->OnChild(
+							[&value](auto && child, auto &&) {
+								child->SetValue(XmlValueSource(value));
+								child->Complete();
+							},
+							valueName);
+					emp->Complete();
+				});
+			}
+		}
+
+		void
+		DocumentStreamIterateDictElements(XmlStreamReader & reader, ModelPartParam dict)
+		{
+			if (reader.empty()) {
+				return;
+			}
+			const auto depth = reader.depth();
+			while (reader.next() && (reader.type() != XML_READER_TYPE_END_ELEMENT || reader.depth() != depth)) {
+				if (reader.type() != XML_READER_TYPE_ELEMENT) {
+					continue;
+				}
+				bool consumed = false;
+				dict->OnAnonChild([&reader, &consumed](auto && emp, auto &&) {
+					emp->Create();
+					emp->OnChild(
+							[&reader](auto && child, auto &&) {
+								child->SetValue(XmlValueSource(reader.name()));
+								child->Complete();
+							},
+							keyName);
+					emp->OnChild(
+							[&reader, &consumed](auto && value, auto && md) {
+								consumed = true;
+								DocumentStreamIterateElement(reader, value, md);
+							},
+							valueName);
+					emp->Complete();
+				});
+				if (!consumed) {
+					reader.skip();
+				}
+			}
+		}
+
+		void
+		DocumentStreamIterateElement(XmlStreamReader & reader, ModelPartParam smp, const Metadata & md)
+		{
+			const auto attrs = reader.attributes();
+			auto oec = [&md, &attrs, &reader](const auto & lmp) {
+				lmp->Create();
+				if (md.flagSet(MetaFlag::XmlAttributes)) {
+					if (!attrs.empty()) {
+						DocumentStreamIterateDictAttrs(attrs, lmp);
+					}
+					reader.skip();
+				}
+				else if (md.flagSet(MetaFlag::XmlElements)) {
+					DocumentStreamIterateDictElements(reader, lmp);
+				}
+				else {
+					for (const auto & [name, value] : attrs) {
+						lmp->OnChild(
+								[&value](auto && amp, auto &&) {
+									amp->Create();
+									amp->SetValue(XmlValueSource(value));
+									amp->Complete();
+								},
+								name, isAttribute);
+					}
+					if (!DocumentStreamIterateChildren(reader, lmp)) {
+						lmp->SetValue(XmlValueSource());
+					}
+				}
+				lmp->Complete();
+			};
+			if (auto typeIdPropName = smp->GetTypeIdProperty()) {
+				if (auto typeAttr = std::find_if(attrs.begin(), attrs.end(),
+							[&typeIdPropName](const auto & attr) {
+								return attr.first == *typeIdPropName;
+							});
+						typeAttr != attrs.end()) {
+					return smp->OnSubclass(oec, typeAttr->second);
+				}
+			}
+			oec(smp);
+		}
+
+		// Reader is on an element start; consumes the element whether or not the model accepts it
+		void
+		DocumentStreamIterateChild(XmlStreamReader & reader, ModelPartParam mp)
+		{
+			bool consumed = false;
+			mp->OnChild(
+					[&reader, &consumed](auto && smp, auto && md) {
+						if (md.flagSet(MetaFlag::XmlBare)) {
+							smp->OnAnonChild([&reader, &consumed](auto && bmp, auto && bmd) {
+								consumed = true;
+								DocumentStreamIterateElement(reader, bmp, bmd);
+							});
+							return;
+						}
+						consumed = true;
+						DocumentStreamIterateElement(reader, smp, md);
+					},
+					reader.name(), notAttribute);
+			if (!consumed) {
+				reader.skip();
+			}
+		}
+
+		// Processes the child nodes of the current element; false if it had none
+		bool
+		DocumentStreamIterateChildren(XmlStreamReader & reader, ModelPartParam mp)
+		{
+			if (reader.empty()) {
+				return false;
+			}
+			const auto depth = reader.depth();
+			bool any = false;
+			while (reader.next() && (reader.type() != XML_READER_TYPE_END_ELEMENT || reader.depth() != depth)) {
+				any = true;
+				switch (const auto type = reader.type()) {
+					case XML_READER_TYPE_ELEMENT:
+						DocumentStreamIterateChild(reader, mp);
+						break;
+					case XML_READER_TYPE_TEXT:
+					case XML_READER_TYPE_CDATA:
+					case XML_READER_TYPE_COMMENT:
+					case XML_READER_TYPE_PROCESSING_INSTRUCTION:
+					case XML_READER_TYPE_WHITESPACE:
+					case XML_READER_TYPE_SIGNIFICANT_WHITESPACE: {
+						const auto content = reader.value();
+						bool bare = false;
+						if (!isWhiteSpace(type, content)) {
+							bare = (mp->OnAnonChild(
+									[&content](auto && smp, auto &&) {
+										smp->SetValue(XmlValueSource(content));
+									},
+									isText));
+						}
+						if (!bare) {
+							mp->SetValue(XmlValueSource(content));
+						}
+						break;
+					}
+					default:
+						break;
+				}
+			}
+			return any;
+		}
+
+		void
+		DocumentStreamIterate(XmlStreamReader & reader, ModelPartParam mp)
+		{
+			while (reader.next()) {
+				if (reader.type() == XML_READER_TYPE_ELEMENT && reader.depth() == 0) {
+					DocumentStreamIterateChild(reader, mp);
+				}
+			}
+		}
+
 		void ModelTreeIterate(xmlpp::Element *, const std::string &, ModelPartParam mp, const HookCommon * hp,
 				const ElementCreator &);
 		void ModelTreeIterateRoot(xmlpp::Document *, const std::string &, ModelPartParam mp);
@@ -382,19 +818,19 @@ namespace Slicer {
 			if (name.empty()) {
 				return;
 			}
-			if (hp && hp->GetMetadata().flagSet(md_attribute)) {
+			if (hp && hp->flagSet(MetaFlag::XmlAttribute)) {
 				mp->GetValue(XmlValueTarget(n, name));
 			}
-			else if (hp && hp->GetMetadata().flagSet(md_text)) {
+			else if (hp && hp->flagSet(MetaFlag::XmlText)) {
 				mp->GetValue(XmlValueTarget(n));
 			}
-			else if (hp && hp->GetMetadata().flagSet(md_attributes)) {
+			else if (hp && hp->flagSet(MetaFlag::XmlAttributes)) {
 				ModelTreeIterateDictAttrs(n->add_child_element(name), mp);
 			}
-			else if (hp && hp->GetMetadata().flagSet(md_elements)) {
+			else if (hp && hp->flagSet(MetaFlag::XmlElements)) {
 				ModelTreeIterateDictElements(n->add_child_element(name), mp);
 			}
-			else if (hp && hp->GetMetadata().flagSet(md_bare)) {
+			else if (hp && hp->flagSet(MetaFlag::XmlBare)) {
 				ModelTreeProcessElement(n, mp, [name](auto && PH1, auto &&) {
 					return PH1->add_child_element(name);
 				});
@@ -481,6 +917,170 @@ namespace Slicer {
 		{
 			ModelTreeProcessElement(doc->create_root_node(name), mp, defaultElementCreator);
 		}
+
+		// Starts its element on first use, as CurrentElementCreator does for the document
+		class LazyElement {
+		public:
+			// The writer's currently open element
+			explicit LazyElement(XmlTextWriter & w) : writer(w), started(true), owned(false) { }
+
+			LazyElement(XmlTextWriter & w, const std::string & n) : writer(w), name(&n) { }
+
+			XmlTextWriter &
+			get()
+			{
+				if (!started) {
+					writer.startElement(*name);
+					started = true;
+				}
+				return writer;
+			}
+
+			void
+			end()
+			{
+				if (started && owned) {
+					writer.endElement();
+				}
+			}
+
+		private:
+			XmlTextWriter & writer;
+			const std::string * name {};
+			bool started {false};
+			bool owned {true};
+		};
+
+		void ModelTreeWrite(XmlTextWriter &, const std::string &, ModelPartParam mp, const HookCommon * hp,
+				const std::string * elementName, bool attributes);
+		void ModelTreeWriteElement(LazyElement &, ModelPartParam mp, const std::string * elementName);
+		void ModelTreeWriteDictAttrs(XmlTextWriter &, ModelPartParam dict);
+		void ModelTreeWriteDictElements(XmlTextWriter &, ModelPartParam dict);
+
+		// Attributes must precede content, so complex types are walked twice: attributes, then everything else
+		void
+		ModelTreeWrite(XmlTextWriter & writer, const std::string & name, ModelPartParam mp, const HookCommon * hp,
+				const std::string * elementName, bool attributes)
+		{
+			if (name.empty()) {
+				return;
+			}
+			if (hp && hp->flagSet(MetaFlag::XmlAttribute)) {
+				if (attributes) {
+					mp->GetValue(XmlValueTarget([&writer, &name](const auto & value) {
+						writer.attribute(name, value);
+					}));
+				}
+			}
+			else if (attributes) {
+				return;
+			}
+			else if (hp && hp->flagSet(MetaFlag::XmlText)) {
+				mp->GetValue(XmlValueTarget([&writer](const auto & value) {
+					writer.text(value);
+				}));
+			}
+			else if (hp && hp->flagSet(MetaFlag::XmlAttributes)) {
+				writer.startElement(name);
+				ModelTreeWriteDictAttrs(writer, mp);
+				writer.endElement();
+			}
+			else if (hp && hp->flagSet(MetaFlag::XmlElements)) {
+				writer.startElement(name);
+				ModelTreeWriteDictElements(writer, mp);
+				writer.endElement();
+			}
+			else if (hp && hp->flagSet(MetaFlag::XmlBare)) {
+				LazyElement current {writer};
+				ModelTreeWriteElement(current, mp, &name);
+			}
+			else {
+				LazyElement element {writer, elementName ? *elementName : name};
+				ModelTreeWriteElement(element, mp, nullptr);
+				element.end();
+			}
+		}
+
+		void
+		ModelTreeWriteDictAttrs(XmlTextWriter & writer, ModelPartParam dict)
+		{
+			dict->OnEachChild([&writer](const auto &, const auto & mp, const auto &) {
+				if (mp->HasValue()) {
+					mp->OnChild(
+							[&mp, &writer](auto && key, auto &&) {
+								key->GetValue(XmlValueTarget([&mp, &writer](const auto & name) {
+									mp->OnChild(
+											[&writer, &name](auto && value, auto &&) {
+												value->GetValue(XmlValueTarget([&writer, &name](const auto & v) {
+													writer.attribute(name.raw(), v);
+												}));
+											},
+											valueName);
+								}));
+							},
+							keyName);
+				}
+			});
+		}
+
+		void
+		ModelTreeWriteDictElements(XmlTextWriter & writer, ModelPartParam dict)
+		{
+			dict->OnEachChild([&writer](const auto &, const auto & mp, const auto &) {
+				if (mp->HasValue()) {
+					mp->OnChild(
+							[&mp, &writer](auto && key, auto &&) {
+								key->GetValue(XmlValueTarget([&mp, &writer](const auto & name) {
+									LazyElement element {writer, name.raw()};
+									mp->OnChild(
+											[&element](auto && value, auto &&) {
+												ModelTreeWriteElement(element, value, nullptr);
+											},
+											valueName);
+									element.end();
+								}));
+							},
+							keyName);
+				}
+			});
+		}
+
+		void
+		ModelTreeWriteElement(LazyElement & element, ModelPartParam mp, const std::string * elementName)
+		{
+			if (mp->GetType() == ModelPartType::Simple) {
+				mp->GetValue(XmlValueTarget([&element](const auto & value) {
+					element.get().text(value);
+				}));
+			}
+			else if (mp->HasValue()) {
+				auto oec = [&element, elementName](const auto & lmp, const std::string * typeIdPropName,
+								   const std::string * typeId) {
+					auto & writer = element.get();
+					if (lmp->GetType() == ModelPartType::Complex) {
+						lmp->OnEachChild([&writer, elementName](auto && name, auto && cmp, auto && hp) {
+							ModelTreeWrite(writer, name, cmp, hp, elementName, true);
+						});
+					}
+					if (typeIdPropName && typeId) {
+						writer.attribute(*typeIdPropName, *typeId);
+					}
+					lmp->OnEachChild([&writer, elementName](auto && name, auto && cmp, auto && hp) {
+						ModelTreeWrite(writer, name, cmp, hp, elementName, false);
+					});
+				};
+				if (auto typeIdPropName = mp->GetTypeIdProperty()) {
+					if (auto typeId = mp->GetTypeId()) {
+						return mp->OnSubclass(
+								[&oec, &typeIdPropName, &typeId](auto && smp) {
+									oec(smp, &*typeIdPropName, &*typeId);
+								},
+								*typeId);
+					}
+				}
+				oec(mp, nullptr, nullptr);
+			}
+		}
 	}
 
 	XmlStreamSerializer::XmlStreamSerializer(std::ostream & s) : strm(s) { }
@@ -490,10 +1090,8 @@ namespace Slicer {
 	void
 	XmlStreamDeserializer::Deserialize(ModelPartForRootParam modelRoot)
 	{
-		xmlpp::DomParser dom;
-		dom.parse_stream(strm);
-		auto doc = dom.get_document();
-		DocumentTreeIterate(doc, modelRoot);
+		XmlStreamReader reader {strm};
+		DocumentStreamIterate(reader, modelRoot);
 	}
 
 	void
@@ -503,6 +1101,178 @@ namespace Slicer {
 		doc.write_to_stream(strm);
 	}
 
+	XmlDirectStreamSerializer::XmlDirectStreamSerializer(std::ostream & s) : strm(s) { }
+
+	void
+	XmlDirectStreamSerializer::Serialize(ModelPartForRootParam modelRoot)
+	{
+		XmlTextWriter writer {strm};
+		writer.startDocument();
+		modelRoot->OnEachChild([&writer](auto && name, auto && mp, auto &&) {
+			LazyElement root {writer, name};
+			root.get();
+			ModelTreeWriteElement(root, mp, nullptr);
+			root.end();
+		});
+		writer.endDocument();
+	}
+
+	void
+	XmlDirectStreamSerializer::serializeChunks(const std::string & rootName, const ChunkSource & chunks)
+	{
+		XmlTextWriter writer {strm};
+		writer.startDocument();
+		writer.startElement(rootName);
+		// Only content closes the root's start tag; an empty root is written self closing, as by Serialize
+		chunks([&writer](std::string && elements) {
+			if (!elements.empty()) {
+				writer.raw(elements);
+			}
+		});
+		writer.endElement();
+		writer.endDocument();
+	}
+
+	std::string
+	XmlDirectStreamSerializer::writeElements(ModelPartParam chunk)
+	{
+		std::ostringstream elements;
+		XmlTextWriter writer {elements};
+		chunk->OnEachChild([&writer](auto && name, auto && emp, auto && hp) {
+			ModelTreeWrite(writer, name, emp, hp, nullptr, false);
+		});
+		writer.flush();
+		return std::move(elements).str();
+	}
+
+	XmlStaticWriter::XmlStaticWriter(std::ostream & s) : writer {std::make_unique<XmlTextWriter>(s)} { }
+
+	XmlStaticWriter::~XmlStaticWriter() = default;
+
+	void
+	XmlStaticWriter::beginRoot(const std::string & name)
+	{
+		writer->startDocument();
+		writer->startElement(name);
+	}
+
+	void
+	XmlStaticWriter::endRoot()
+	{
+		writer->endElement();
+		writer->endDocument();
+	}
+
+	void
+	XmlStaticWriter::null()
+	{
+	}
+
+	void
+	XmlStaticWriter::beginObject()
+	{
+	}
+
+	void
+	XmlStaticWriter::endObject()
+	{
+	}
+
+	void
+	XmlStaticWriter::beginMember(const std::string & name)
+	{
+		writer->startElement(name);
+	}
+
+	void
+	XmlStaticWriter::endMember()
+	{
+		writer->endElement();
+	}
+
+	void
+	XmlStaticWriter::beginArray()
+	{
+	}
+
+	void
+	XmlStaticWriter::endArray()
+	{
+	}
+
+	void
+	XmlStaticWriter::beginElement(const std::string & name)
+	{
+		writer->startElement(name);
+	}
+
+	void
+	XmlStaticWriter::endElement()
+	{
+		writer->endElement();
+	}
+
+	void
+	XmlStaticWriter::value(bool v)
+	{
+		writer->text(v ? TrueText : FalseText);
+	}
+
+	void
+	XmlStaticWriter::value(Ice::Byte v)
+	{
+		writer->text(Glib::ustring::format(v));
+	}
+
+	void
+	XmlStaticWriter::value(Ice::Short v)
+	{
+		writer->text(Glib::ustring::format(v));
+	}
+
+	void
+	XmlStaticWriter::value(Ice::Int v)
+	{
+		writer->text(Glib::ustring::format(v));
+	}
+
+	void
+	XmlStaticWriter::value(Ice::Long v)
+	{
+		writer->text(Glib::ustring::format(v));
+	}
+
+	void
+	XmlStaticWriter::value(Ice::Float v)
+	{
+		writer->text(Glib::ustring::format(v));
+	}
+
+	void
+	XmlStaticWriter::value(Ice::Double v)
+	{
+		writer->text(Glib::ustring::format(v));
+	}
+
+	void
+	XmlStaticWriter::value(const std::string & v)
+	{
+		writer->text(v);
+	}
+
+	void
+	XmlStaticWriter::fallback(ModelPartParam mp)
+	{
+		LazyElement current {*writer};
+		ModelTreeWriteElement(current, mp, nullptr);
+	}
+
+	void
+	XmlStaticWriter::fallbackMember(const std::string & name, ModelPartParam mp)
+	{
+		ModelTreeWrite(*writer, name, mp, nullptr, nullptr, false);
+	}
+
 	XmlFileSerializer::XmlFileSerializer(const std::filesystem::path & p) : XmlStreamSerializer {strm}, strm(p) { }
 
 	XmlFileDeserializer::XmlFileDeserializer(std::filesystem::path p) : path(std::move(p)) { }
@@ -510,9 +1280,8 @@ namespace Slicer {
 	void
 	XmlFileDeserializer::Deserialize(ModelPartForRootParam modelRoot)
 	{
-		xmlpp::DomParser dom(path);
-		auto doc = dom.get_document();
-		DocumentTreeIterate(doc, modelRoot);
+		XmlStreamReader reader {path};
+		DocumentStreamIterate(reader, modelRoot);
 	}
 
 	XmlDocumentDeserializer::XmlDocumentDeserializer(const xmlpp::Document * d) : doc(d) { }
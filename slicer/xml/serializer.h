@@ -10,8 +10,13 @@
 #pragma GCC diagnostic pop
 #include <filesystem>
 #include <fstream>
+#include <memory>
 #include <slicer/modelParts.h>
+#include <slicer/modelPartsTypes.h>
+#include <slicer/parallel.h>
 #include <slicer/serializer.h>
+#include <slicer/staticSerializer.h>
+#include <string>
 #include <visibility.h>
 
 namespace Glib {
@@ -19,6 +24,8 @@ namespace Glib {
 }
 
 namespace Slicer {
+	class XmlTextWriter;
+
 	class DLL_PUBLIC XmlDocumentSerializer : public Serializer {
 	public:
 		void Serialize(ModelPartForRootParam) override;
@@ -37,6 +44,73 @@ namespace Slicer {
 		std::ostream & strm;
 	};
 
+	// Writes elements and attributes to the stream with xmlTextWriter as the model is walked, without a document
+	class DLL_PUBLIC XmlDirectStreamSerializer : public Serializer {
+	public:
+		explicit XmlDirectStreamSerializer(std::ostream &);
+
+		void Serialize(ModelPartForRootParam) override;
+
+		// Writes the same as serializing seq, with chunks of its elements written concurrently on up to threads
+		// threads (0 for one per core)
+		template<typename Seq>
+		void
+		SerializeParallel(const Seq & seq, unsigned int threads = 0)
+		{
+			serializeChunks(ModelPartForRoot<Seq>::rootName, [&seq, threads](auto && emit) {
+				writeChunksParallel(
+						seq.begin(), seq.end(), threads,
+						[](auto chunkBegin, auto chunkEnd) {
+							return writeElements(ModelPartForSequenceChunk<const Seq> {chunkBegin, chunkEnd});
+						},
+						emit);
+			});
+		}
+
+	protected:
+		void serializeChunks(const std::string & rootName, const ChunkSource &);
+		[[nodiscard]] static std::string writeElements(ModelPartParam chunk);
+
+		std::ostream & strm;
+	};
+
+	// Writes XML for SerializeStatic, the same as XmlDirectStreamSerializer's output
+	class DLL_PUBLIC XmlStaticWriter : public StaticWriter {
+	public:
+		explicit XmlStaticWriter(std::ostream &);
+		~XmlStaticWriter() override;
+		SPECIAL_MEMBERS_DELETE(XmlStaticWriter);
+
+		void beginRoot(const std::string & name) override;
+		void endRoot() override;
+		void null() override;
+
+		void beginObject() override;
+		void endObject() override;
+		void beginMember(const std::string & name) override;
+		void endMember() override;
+
+		void beginArray() override;
+		void endArray() override;
+		void beginElement(const std::string & name) override;
+		void endElement() override;
+
+		void value(bool) override;
+		void value(Ice::Byte) override;
+		void value(Ice::Short) override;
+		void value(Ice::Int) override;
+		void value(Ice::Long) override;
+		void value(Ice::Float) override;
+		void value(Ice::Double) override;
+		void value(const std::string &) override;
+
+		void fallback(ModelPartParam mp) override;
+		void fallbackMember(const std::string & name, ModelPartParam mp) override;
+
+	protected:
+		std::unique_ptr<XmlTextWriter> writer;
+	};
+
 	class DLL_PUBLIC XmlFileSerializer : public XmlStreamSerializer {
 	public:
 		explicit XmlFileSerializer(const std::filesystem::path &);
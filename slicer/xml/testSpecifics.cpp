@@ -81,4 +81,5 @@ BOOST_AUTO_TEST_CASE(factories)
 	BOOST_REQUIRE(Slicer::FileDeserializerFactory::createNew(".xml", "/some.xml"));
 	BOOST_REQUIRE(Slicer::StreamSerializerFactory::createNew("application/xml", std::cout));
 	BOOST_REQUIRE(Slicer::StreamDeserializerFactory::createNew("application/xml", std::cin));
+	BOOST_REQUIRE(Slicer::StreamSerializerFactory::createNew("application/xml+direct", std::cout));
 }